@@ -0,0 +1,147 @@
+#include "includes/minishell.h"
+#include <stdio.h>
+
+/**
+ * audit_start - Starts the writer thread with every signal blocked
+ * @a: Audit log
+ *
+ * The thread inherits the mask in force when it is created, so SIGINT
+ * and the others are only ever delivered to the main thread: the
+ * prompt's handler redraws readline there, and the EINTR the builtins
+ * wait for is not spent on sem_timedwait().
+ *
+ * Returns: 1 on success, 0 on failure
+ */
+static int	audit_start(t_audit *a)
+{
+	sigset_t	all;
+	sigset_t	old;
+	int			err;
+
+	sigfillset(&all);
+	pthread_sigmask(SIG_SETMASK, &all, &old);
+	err = pthread_create(&a->writer, NULL, audit_writer, a);
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+	return (err == 0);
+}
+
+/**
+ * audit_init - Starts the audit log when MINISHELL_AUDIT names a file
+ * @shell: Shell context
+ *
+ * The ring and the writer thread are set up once here; the shell loop
+ * only ever copies a record into the ring. Without the variable
+ * shell->audit stays NULL and nothing is recorded.
+ */
+void	audit_init(t_shell *shell)
+{
+	t_audit	*a;
+	char	*path;
+
+	path = getenv("MINISHELL_AUDIT");
+	if (!path || !*path)
+		return ;
+	a = ft_calloc(1, sizeof(t_audit));
+	if (!a)
+		return ;
+	a->fd = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0600);
+	if (a->fd == -1 || sem_init(&a->wake, 0, 0) == -1)
+	{
+		perror("minishell: MINISHELL_AUDIT");
+		if (a->fd != -1)
+			close(a->fd);
+		free(a);
+		return ;
+	}
+	a->pid = getpid();
+	if (!audit_start(a))
+	{
+		ft_putstr_fd("minishell: MINISHELL_AUDIT: no writer thread\n", 2);
+		sem_destroy(&a->wake);
+		close(a->fd);
+		free(a);
+		return ;
+	}
+	shell->audit = a;
+}
+
+/**
+ * audit_begin - Notes when the line about to run started
+ * @shell: Shell context
+ */
+void	audit_begin(t_shell *shell)
+{
+	if (!shell->audit)
+		return ;
+	clock_gettime(CLOCK_REALTIME, &shell->audit->start);
+	shell->audit->t0 = trace_now();
+}
+
+/**
+ * audit_record - Queues the record of the line started by audit_begin()
+ * @shell: Shell context
+ * @line: Command line as typed
+ *
+ * Never blocks and never allocates: the record is copied into the next
+ * free slot of the ring. When the writer has fallen AUDIT_RING records
+ * behind, the record is dropped and only counted; the writer logs how
+ * many were lost once it catches up. Forked children, which inherit
+ * shell->audit but not the writer, record nothing.
+ */
+void	audit_record(t_shell *shell, char *line)
+{
+	t_audit		*a;
+	t_audit_rec	*r;
+	size_t		head;
+	size_t		len;
+
+	a = shell->audit;
+	if (!a || a->pid != getpid())
+		return ;
+	head = a->head;
+	if (head - __atomic_load_n(&a->tail, __ATOMIC_ACQUIRE) == AUDIT_RING)
+	{
+		__atomic_fetch_add(&a->dropped, 1, __ATOMIC_RELAXED);
+		return ;
+	}
+	r = &a->ring[head % AUDIT_RING];
+	r->start = a->start;
+	r->dur_ns = trace_now() - a->t0;
+	r->status = shell->exit_status;
+	len = ft_strlcpy(r->cmd, line, sizeof(r->cmd));
+	r->truncated = (len >= sizeof(r->cmd));
+	r->cwd[0] = '\0';
+	if (shell->cwd.path)
+		ft_strlcpy(r->cwd, shell->cwd.path, sizeof(r->cwd));
+	__atomic_store_n(&a->head, head + 1, __ATOMIC_RELEASE);
+	sem_post(&a->wake);
+}
+
+/**
+ * audit_close - Flushes the audit log and stops the writer
+ * @shell: Shell context
+ *
+ * Called when the shell exits; forked children, which have no writer
+ * thread, never touch it. Reports on stderr how many records were
+ * dropped during the session.
+ */
+void	audit_close(t_shell *shell)
+{
+	t_audit	*a;
+	long	dropped;
+
+	a = shell->audit;
+	if (!a || a->pid != getpid())
+		return ;
+	__atomic_store_n(&a->stop, 1, __ATOMIC_RELEASE);
+	sem_post(&a->wake);
+	pthread_join(a->writer, NULL);
+	dropped = __atomic_load_n(&a->dropped, __ATOMIC_RELAXED);
+	if (dropped)
+		fprintf(stderr, "minishell: audit: %ld record(s) dropped\n",
+			dropped);
+	sem_destroy(&a->wake);
+	close(a->fd);
+	free(a);
+	shell->audit = NULL;
+}
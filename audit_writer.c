@@ -0,0 +1,181 @@
+#include "includes/minishell.h"
+#include <stdio.h>
+
+/**
+ * audit_str - Appends a JSON string, quotes and escapes included
+ * @w: Batch being built
+ * @s: NUL-terminated string
+ */
+static void	audit_str(t_audit_batch *w, const char *s)
+{
+	static const char	hex[] = "0123456789abcdef";
+	unsigned char		c;
+
+	w->buf[w->len++] = '"';
+	while (*s && w->len < sizeof(w->buf) - 8)
+	{
+		c = *s++;
+		if (c == '"' || c == '\\')
+			w->buf[w->len++] = '\\';
+		if (c < 0x20)
+		{
+			w->len += snprintf(w->buf + w->len, 7, "\\u00%c%c", hex[c >> 4],
+					hex[c & 15]);
+			continue ;
+		}
+		w->buf[w->len++] = c;
+	}
+	w->buf[w->len++] = '"';
+}
+
+/**
+ * audit_format - Appends one record as a JSON line
+ * @w: Batch being built, with room for AUDIT_REC_MAX more bytes
+ * @r: Record
+ *
+ * {"ts":"2026-01-02T03:04:05.678Z","cwd":"/home","cmd":"ls -l",
+ *  "duration_ms":1.234,"status":0}
+ */
+static void	audit_format(t_audit_batch *w, t_audit_rec *r)
+{
+	struct tm	tm;
+
+	gmtime_r(&r->start.tv_sec, &tm);
+	w->len += snprintf(w->buf + w->len, 48,
+			"{\"ts\":\"%04d-%02d-%02dT%02d:%02d:%02d.%03ldZ\",\"cwd\":",
+			tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour,
+			tm.tm_min, tm.tm_sec, r->start.tv_nsec / 1000000);
+	audit_str(w, r->cwd);
+	w->len += snprintf(w->buf + w->len, 8, ",\"cmd\":");
+	audit_str(w, r->cmd);
+	w->len += snprintf(w->buf + w->len, 64,
+			",\"duration_ms\":%ld.%03ld,\"status\":%d%s}\n",
+			r->dur_ns / 1000000, r->dur_ns / 1000 % 1000, r->status,
+			r->truncated ? ",\"truncated\":true" : "");
+	w->recs++;
+}
+
+/**
+ * audit_dropped - Appends how many records were lost since the last report
+ * @a: Audit log
+ * @w: Batch being built
+ */
+static void	audit_dropped(t_audit *a, t_audit_batch *w)
+{
+	long	dropped;
+
+	dropped = __atomic_load_n(&a->dropped, __ATOMIC_RELAXED);
+	if (dropped == a->reported)
+		return ;
+	w->len += snprintf(w->buf + w->len, 48, "{\"dropped\":%ld}\n",
+			dropped - a->reported);
+	a->reported = dropped;
+}
+
+/**
+ * audit_flush - Writes the whole batch out
+ * @a: Audit log
+ * @w: Batch, emptied
+ *
+ * Short writes are continued. On a hard error the records still in the
+ * batch are added to the dropped count rather than lost silently.
+ *
+ * Returns: 1 if anything was written
+ */
+static int	audit_flush(t_audit *a, t_audit_batch *w)
+{
+	size_t	done;
+	ssize_t	n;
+
+	done = 0;
+	while (done < w->len)
+	{
+		n = write(a->fd, w->buf + done, w->len - done);
+		if (n == -1 && errno == EINTR)
+			continue ;
+		if (n == -1)
+		{
+			__atomic_fetch_add(&a->dropped, w->recs, __ATOMIC_RELAXED);
+			break ;
+		}
+		done += n;
+	}
+	w->len = 0;
+	w->recs = 0;
+	return (done > 0);
+}
+
+/**
+ * audit_drain - Writes every queued record, in batches of one write()
+ * @a: Audit log
+ * @w: Batch buffer of the writer thread
+ *
+ * Returns: 1 if anything was written
+ */
+static int	audit_drain(t_audit *a, t_audit_batch *w)
+{
+	size_t	head;
+	int		wrote;
+
+	wrote = 0;
+	head = __atomic_load_n(&a->head, __ATOMIC_ACQUIRE);
+	while (1)
+	{
+		while (a->tail != head && w->len < sizeof(w->buf) - AUDIT_REC_MAX)
+		{
+			audit_format(w, &a->ring[a->tail % AUDIT_RING]);
+			__atomic_store_n(&a->tail, a->tail + 1, __ATOMIC_RELEASE);
+		}
+		audit_dropped(a, w);
+		if (!w->len)
+			break ;
+		wrote |= audit_flush(a, w);
+	}
+	return (wrote);
+}
+
+/**
+ * audit_writer - Body of the writer thread
+ * @arg: Audit log
+ *
+ * Sleeps on the semaphore the shell posts after every record and drains
+ * the ring when woken. Data written since the last sync is pushed to
+ * disk with fdatasync() at most every AUDIT_SYNC_MS, and once more when
+ * the shell exits.
+ *
+ * Returns: NULL
+ */
+void	*audit_writer(void *arg)
+{
+	t_audit			*a;
+	t_audit_batch	w;
+	struct timespec	until;
+	long			last_sync;
+	int				dirty;
+
+	a = arg;
+	w.len = 0;
+	w.recs = 0;
+	dirty = 0;
+	last_sync = trace_now();
+	while (!__atomic_load_n(&a->stop, __ATOMIC_ACQUIRE))
+	{
+		clock_gettime(CLOCK_REALTIME, &until);
+		until.tv_sec += AUDIT_SYNC_MS / 1000;
+		until.tv_nsec += AUDIT_SYNC_MS % 1000 * 1000000L;
+		if (until.tv_nsec >= 1000000000L)
+			until.tv_sec++;
+		until.tv_nsec %= 1000000000L;
+		sem_timedwait(&a->wake, &until);
+		dirty |= audit_drain(a, &w);
+		if (dirty && trace_now() - last_sync >= AUDIT_SYNC_MS * 1000000L)
+		{
+			fdatasync(a->fd);
+			last_sync = trace_now();
+			dirty = 0;
+		}
+	}
+	if (audit_drain(a, &w) || dirty)
+		fdatasync(a->fd);
+	return (NULL);
+}
@@ -0,0 +1,194 @@
+#include "includes/minishell.h"
+#include <stdio.h>
+
+// ANSI Colors
+#define GREEN   "\033[32m"
+#define CYAN    "\033[36m"
+#define BOLD    "\033[1m"
+#define RESET   "\033[0m"
+
+// Median of a bench, once bench_report() has sorted the samples
+static double	median_ms(t_bench *b)
+{
+	if (b->done == 0)
+		return (0);
+	return ((b->samples[(b->done - 1) / 2] + b->samples[b->done / 2]) / 2);
+}
+
+static double	bench_line(char *line, int runs, t_shell *shell)
+{
+	t_bench		b;
+	t_token		*tokens;
+	t_ast_node	*ast;
+	double		median;
+
+	ft_memset(&b, 0, sizeof(t_bench));
+	b.line = line;
+	b.runs = runs;
+	b.warmup = runs / 10 + 1;
+	tokens = lexer(line);
+	ast = parse(tokens);
+	median = 0;
+	if (ast && expand_ast(ast, shell))
+	{
+		bench_run(&b, ast, shell);
+		bench_report(&b);
+		median = median_ms(&b);
+	}
+	free(b.samples);
+	ast_free(ast);
+	token_lstclear(&tokens);
+	return (median);
+}
+
+// cat builtin vs /bin/cat on 4 KB, 1 MB and a sparse 4 GB file. The
+// last one is all holes: it measures how fast each copies a hole to
+// /dev/null, not disk throughput, and is labelled as such
+static void	bench_cat(int runs, t_shell *shell)
+{
+	size_t	sizes[] = {4096, 1 << 20, (size_t)4 << 30};
+	char	*lines[][2] = {
+		{"cat /tmp/minishell_cat_4k > /tmp/minishell_cat_out",
+			"/bin/cat /tmp/minishell_cat_4k > /tmp/minishell_cat_out"},
+		{"cat /tmp/minishell_cat_1m > /tmp/minishell_cat_out",
+			"/bin/cat /tmp/minishell_cat_1m > /tmp/minishell_cat_out"},
+		{"cat /tmp/minishell_cat_4g > /dev/null",
+			"/bin/cat /tmp/minishell_cat_4g > /dev/null"}
+	};
+	static char	data[1 << 20];
+	char	*files[] = {"/tmp/minishell_cat_4k", "/tmp/minishell_cat_1m",
+		"/tmp/minishell_cat_4g"};
+	char	*labels[] = {"4096", "1048576", "4G sparse"};
+	double	builtin;
+	double	external;
+	int		fd;
+	int		i;
+
+	ft_printf("%s%s=== cat builtin vs /bin/cat ===%s\n", BOLD, CYAN, RESET);
+	ft_memset(data, 'x', sizeof(data));
+	i = 0;
+	while (i < 3)
+	{
+		fd = open(files[i], O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (i < 2)
+			write(fd, data, sizes[i]);
+		else
+			ftruncate(fd, sizes[i]);
+		close(fd);
+		if (i == 2)
+			runs = 1;
+		builtin = bench_line(lines[i][0], runs, shell);
+		external = bench_line(lines[i][1], runs, shell);
+		printf("%s%-10s builtin %.1f MB/s  external %.1f MB/s%s\n\n", GREEN,
+			labels[i], sizes[i] / 1e3 / builtin, sizes[i] / 1e3 / external,
+			RESET);
+		fflush(stdout);
+		unlink(files[i]);
+		i++;
+	}
+	unlink("/tmp/minishell_cat_out");
+}
+
+// read builtin on a file of n lines, redirected onto stdin once
+static void	bench_read(long n, t_shell *shell)
+{
+	static char		buf[1 << 16];
+	struct timespec	start;
+	struct timespec	end;
+	t_token			*tokens;
+	t_ast_node		*ast;
+	char			*name;
+	long			count;
+	size_t			len;
+	double			secs;
+	int				saved;
+	int				fd;
+
+	ft_printf("%s%s=== read builtin (%d lines) ===%s\n", BOLD, CYAN, (int)n,
+		RESET);
+	name = "/tmp/minishell_read_lines";
+	fd = open(name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	len = 0;
+	count = 0;
+	while (count < n)
+	{
+		len += snprintf(buf + len, 64, "line %ld field\tvalue\n", count++);
+		if (len > sizeof(buf) - 64 || count == n)
+		{
+			write(fd, buf, len);
+			len = 0;
+		}
+	}
+	close(fd);
+	saved = dup(0);
+	fd = open(name, O_RDONLY);
+	dup2(fd, 0);
+	close(fd);
+	tokens = lexer("read -r a b c");
+	ast = parse(tokens);
+	expand_ast(ast, shell);
+	count = 0;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	while (exec_builtin(ast, shell) == 0)
+		count++;
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	secs = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+	printf("%s%ld lines in %.2f s: %.0f lines/s%s\n\n", GREEN, count, secs,
+		count / secs, RESET);
+	fflush(stdout);
+	dup2(saved, 0);
+	close(saved);
+	ast_free(ast);
+	token_lstclear(&tokens);
+	unlink(name);
+}
+
+int	main(int ac, char **av, char **envp)
+{
+	t_shell	shell;
+	char	*conditions[] = {
+		"-f Makefile",
+		"-d includes -a -r Makefile",
+		"abc = abc",
+		"10 -gt 9",
+		NULL
+	};
+	char	*line;
+	double	builtin;
+	double	external;
+	int		runs;
+	int		i;
+
+	runs = 1000;
+	if (ac > 1)
+		runs = ft_atoi(av[1]);
+	ft_memset(&shell, 0, sizeof(t_shell));
+	init_shell(envp, &shell);
+	ft_printf("%s%s=== test builtin vs /usr/bin/test (%d runs) ===%s\n",
+		BOLD, CYAN, runs, RESET);
+	i = 0;
+	while (conditions[i])
+	{
+		line = ft_strjoin("test ", conditions[i]);
+		builtin = bench_line(line, runs, &shell);
+		free(line);
+		line = ft_strjoin("/usr/bin/test ", conditions[i]);
+		external = bench_line(line, runs, &shell);
+		free(line);
+		printf("%s%-28s builtin %.4f ms  external %.4f ms  x%.0f%s\n\n",
+			GREEN, conditions[i], builtin, external,
+			builtin > 0 ? external / builtin : 0, RESET);
+		fflush(stdout);
+		i++;
+	}
+	bench_cat(runs / 10 + 1, &shell);
+	if (ac > 2)
+		bench_read(atol(av[2]), &shell);
+	else
+		bench_read(10000000, &shell);
+	waitset_free(&shell.children);
+	free(shell.pipestatus);
+	free(shell.readbuf.data);
+	env_free(&shell);
+	return (0);
+}
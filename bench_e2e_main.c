@@ -0,0 +1,268 @@
+#include "includes/minishell.h"
+#include <stdio.h>
+#include <sys/stat.h>
+
+// ANSI Colors
+#define GREEN   "\033[32m"
+#define YELLOW  "\033[33m"
+#define CYAN    "\033[36m"
+#define BOLD    "\033[1m"
+#define RESET   "\033[0m"
+
+#define E2E_SHELLS 3
+#define E2E_DIR "/tmp/minishell_e2e"
+
+typedef struct s_e2e {
+	char	*name;
+	void	(*write)(FILE *f);
+	int		runs;            // Multiplier of the run count (startup is cheap)
+	double	ms[E2E_SHELLS];  // Median wall time per shell, -1 if absent
+} t_e2e;
+
+static void	write_startup(FILE *f)
+{
+	fprintf(f, "exit 0\n");
+}
+
+static void	write_simple(FILE *f)
+{
+	int	i;
+
+	i = 0;
+	while (i < 10000)
+		fprintf(f, "echo line %d\n", i++);
+}
+
+static void	write_pipelines(FILE *f)
+{
+	int	i;
+
+	i = 0;
+	while (i++ < 100)
+	{
+		fprintf(f, "cat %s/corpus | tr a-z A-Z | sort | uniq -c | wc -l\n",
+			E2E_DIR);
+		fprintf(f, "grep -c ab < %s/corpus | cat\n", E2E_DIR);
+	}
+}
+
+static void	write_heredocs(FILE *f)
+{
+	int	i;
+	int	j;
+
+	i = 0;
+	while (i++ < 500)
+	{
+		fprintf(f, "cat << EOF\n");
+		j = 0;
+		while (j++ < 20)
+			fprintf(f, "heredoc line %d of %d $HOME\n", j, i);
+		fprintf(f, "EOF\n");
+	}
+}
+
+static void	write_env(FILE *f)
+{
+	int	i;
+	int	j;
+
+	i = 0;
+	while (i < 2000)
+	{
+		fprintf(f, "export E2E_VAR_%d=value_%d\n", i, i);
+		i++;
+	}
+	i = 0;
+	while (i++ < 1000)
+	{
+		fprintf(f, "echo");
+		j = 0;
+		while (j < 20)
+			fprintf(f, " $E2E_VAR_%d", (i * 37 + j++ * 101) % 2000);
+		fprintf(f, " $HOME \"$PATH\"\n");
+	}
+}
+
+static void	write_corpus(void)
+{
+	static const char	*words[] = {"alpha", "beta", "gamma", "abacus",
+		"delta", "cab", "epsilon", "zeta"};
+	FILE				*f;
+	int					i;
+
+	f = fopen(E2E_DIR "/corpus", "w");
+	if (!f)
+		return ;
+	i = 0;
+	while (i < 5000)
+	{
+		fprintf(f, "%s %s %d\n", words[i % 8], words[i * 7 % 8], i % 97);
+		i++;
+	}
+	fclose(f);
+}
+
+// Looks a program up in PATH; returns an allocated path or NULL
+static char	*find_shell(const char *name)
+{
+	char	buf[4096];
+	char	*path;
+	char	*end;
+	size_t	len;
+
+	if (strchr(name, '/'))
+		return (access(name, X_OK) ? NULL : strdup(name));
+	path = getenv("PATH");
+	while (path && *path)
+	{
+		end = strchr(path, ':');
+		len = end ? (size_t)(end - path) : strlen(path);
+		snprintf(buf, sizeof(buf), "%.*s/%s", (int)len, path, name);
+		if (access(buf, X_OK) == 0)
+			return (strdup(buf));
+		path += len + (end != NULL);
+	}
+	return (NULL);
+}
+
+static double	now_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e3 + ts.tv_nsec / 1e6);
+}
+
+// Runs shell with script on stdin and its output thrown away
+static double	run_script(char *shell, char *script)
+{
+	double	start;
+	pid_t	pid;
+	int		fd;
+
+	start = now_ms();
+	pid = fork();
+	if (pid == 0)
+	{
+		fd = open(script, O_RDONLY);
+		dup2(fd, 0);
+		close(fd);
+		fd = open("/dev/null", O_WRONLY);
+		dup2(fd, 1);
+		dup2(fd, 2);
+		close(fd);
+		execl(shell, shell, (char *)NULL);
+		_exit(127);
+	}
+	if (pid < 0)
+		return (-1);
+	waitpid(pid, NULL, 0);
+	return (now_ms() - start);
+}
+
+static int	cmp_double(const void *a, const void *b)
+{
+	double	x;
+	double	y;
+
+	x = *(const double *)a;
+	y = *(const double *)b;
+	return ((x > y) - (x < y));
+}
+
+static double	median_run(char *shell, char *script, int runs)
+{
+	double	samples[256];
+	int		i;
+
+	if (runs > 256)
+		runs = 256;
+	run_script(shell, script);
+	i = 0;
+	while (i < runs)
+		samples[i++] = run_script(shell, script);
+	qsort(samples, runs, sizeof(double), cmp_double);
+	return ((samples[(runs - 1) / 2] + samples[runs / 2]) / 2);
+}
+
+static void	print_ratio(double ms, double other)
+{
+	if (other <= 0 || ms <= 0)
+		printf("  %8s", "-");
+	else
+		printf("  %s%7.2fx%s", ms / other > 1.5 ? YELLOW : GREEN,
+			ms / other, RESET);
+}
+
+/*
+** Usage: bench_e2e [runs]
+** Writes one script per category to E2E_DIR and runs it on the stdin of
+** ./minishell, dash and bash (those found in PATH), output discarded.
+** Each category reports the median wall time over runs (default 5; 20x
+** that for startup) and minishell's cost relative to the other shells.
+*/
+int	main(int ac, char **av)
+{
+	t_e2e	cats[] = {{"startup", write_startup, 20, {0, 0, 0}},
+		{"simple_10k", write_simple, 1, {0, 0, 0}},
+		{"pipelines", write_pipelines, 1, {0, 0, 0}},
+		{"heredocs", write_heredocs, 1, {0, 0, 0}},
+		{"env_expand", write_env, 1, {0, 0, 0}}};
+	char	*names[E2E_SHELLS] = {"./minishell", "dash", "bash"};
+	char	*shells[E2E_SHELLS];
+	char	script[256];
+	FILE	*f;
+	int		runs;
+	int		i;
+	int		s;
+
+	runs = 5;
+	if (ac > 1)
+		runs = atoi(av[1]);
+	if (runs < 1)
+		runs = 1;
+	mkdir(E2E_DIR, 0755);
+	write_corpus();
+	s = -1;
+	while (++s < E2E_SHELLS)
+		shells[s] = find_shell(names[s]);
+	printf("%s%s=== end-to-end: median of %d runs (ms) ===%s\n", BOLD, CYAN,
+		runs, RESET);
+	printf("%-12s %10s %10s %10s  %8s  %8s\n", "category", "minishell",
+		"dash", "bash", "vs dash", "vs bash");
+	i = -1;
+	while (++i < (int)(sizeof(cats) / sizeof(*cats)))
+	{
+		snprintf(script, sizeof(script), "%s/%s.sh", E2E_DIR, cats[i].name);
+		f = fopen(script, "w");
+		if (!f)
+			return (perror(script), 1);
+		cats[i].write(f);
+		fclose(f);
+		printf("%-12s", cats[i].name);
+		s = -1;
+		while (++s < E2E_SHELLS)
+		{
+			cats[i].ms[s] = -1;
+			if (shells[s])
+				cats[i].ms[s] = median_run(shells[s], script,
+						runs * cats[i].runs);
+			if (cats[i].ms[s] < 0)
+				printf(" %10s", "-");
+			else
+				printf(" %10.2f", cats[i].ms[s]);
+			fflush(stdout);
+		}
+		print_ratio(cats[i].ms[0], cats[i].ms[1]);
+		print_ratio(cats[i].ms[0], cats[i].ms[2]);
+		printf("\n");
+		unlink(script);
+	}
+	unlink(E2E_DIR "/corpus");
+	rmdir(E2E_DIR);
+	s = -1;
+	while (++s < E2E_SHELLS)
+		free(shells[s]);
+	return (0);
+}
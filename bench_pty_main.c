@@ -0,0 +1,225 @@
+#include "includes/minishell.h"
+#include <stdio.h>
+#include <poll.h>
+#include <pty.h>
+
+// ANSI Colors
+#define CYAN    "\033[36m"
+#define BOLD    "\033[1m"
+#define RESET   "\033[0m"
+
+#define PTY_TIMEOUT_MS 5000
+#define PTY_BIG_ENV 10000
+#define PTY_HISTORY 5000
+
+extern char	**environ;
+
+typedef struct s_pty {
+	int		fd;              // Master side
+	pid_t	pid;
+	char	buf[4096];       // Output seen since the last pty_mark()
+	size_t	len;
+} t_pty;
+
+static double	now_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e3 + ts.tv_nsec / 1e6);
+}
+
+static void	pty_mark(t_pty *p)
+{
+	p->len = 0;
+}
+
+// Reads what is available, waiting up to ms; returns 0 on timeout or EOF
+static int	pty_read(t_pty *p, int ms)
+{
+	struct pollfd	pfd;
+	ssize_t			n;
+
+	pfd.fd = p->fd;
+	pfd.events = POLLIN;
+	if (poll(&pfd, 1, ms) <= 0)
+		return (0);
+	if (p->len == sizeof(p->buf))
+	{
+		ft_memmove(p->buf, p->buf + p->len / 2, p->len - p->len / 2);
+		p->len -= p->len / 2;
+	}
+	n = read(p->fd, p->buf + p->len, sizeof(p->buf) - p->len);
+	if (n <= 0)
+		return (0);
+	p->len += n;
+	return (1);
+}
+
+// The prompt is ">" and readline writes nothing after it until a key
+static int	at_prompt(t_pty *p)
+{
+	return (p->len > 0 && p->buf[p->len - 1] == '>');
+}
+
+static int	wait_prompt(t_pty *p)
+{
+	while (!at_prompt(p))
+		if (!pty_read(p, PTY_TIMEOUT_MS))
+			return (0);
+	return (1);
+}
+
+static int	wait_byte(t_pty *p, char c)
+{
+	while (!memchr(p->buf, c, p->len))
+		if (!pty_read(p, PTY_TIMEOUT_MS))
+			return (0);
+	return (1);
+}
+
+static void	drain(t_pty *p)
+{
+	pty_mark(p);
+	while (pty_read(p, 20))
+		pty_mark(p);
+}
+
+static int	pty_spawn(t_pty *p, int big_env)
+{
+	char	**env;
+	char	var[64];
+	int		n;
+	int		i;
+
+	n = 0;
+	while (environ[n])
+		n++;
+	env = malloc(sizeof(char *) * (n + PTY_BIG_ENV + 1));
+	if (!env)
+		return (0);
+	i = -1;
+	while (++i < n)
+		env[i] = environ[i];
+	while (big_env && i < n + PTY_BIG_ENV)
+	{
+		snprintf(var, sizeof(var), "PTY_BENCH_%d=value_%d", i - n, i - n);
+		env[i++] = strdup(var);
+	}
+	env[i] = NULL;
+	p->pid = forkpty(&p->fd, NULL, NULL, NULL);
+	if (p->pid == 0)
+	{
+		execve("./minishell", (char *[]){"./minishell", NULL}, env);
+		_exit(127);
+	}
+	while (i-- > n)
+		free(env[i]);
+	free(env);
+	p->len = 0;
+	return (p->pid > 0 && wait_prompt(p));
+}
+
+// Types a command and times Enter until the next prompt
+static double	enter_latency(t_pty *p, char *cmd)
+{
+	double	start;
+
+	write(p->fd, cmd, ft_strlen(cmd));
+	wait_byte(p, cmd[ft_strlen(cmd) - 1]);
+	pty_mark(p);
+	start = now_ms();
+	write(p->fd, "\r", 1);
+	if (!wait_prompt(p))
+		return (-1);
+	return (now_ms() - start);
+}
+
+// Times one keystroke until readline echoes it; Ctrl-U clears the line
+static double	key_latency(t_pty *p, int i)
+{
+	double	start;
+	char	c;
+
+	if (i % 64 == 63)
+	{
+		write(p->fd, "\025", 1);
+		drain(p);
+	}
+	c = 'a' + i % 26;
+	pty_mark(p);
+	start = now_ms();
+	write(p->fd, &c, 1);
+	if (!wait_byte(p, c))
+		return (-1);
+	return (now_ms() - start);
+}
+
+static void	run_session(char *name, int big_env, int history, int runs)
+{
+	t_bench	enter;
+	t_bench	key;
+	char	line[128];
+	t_pty	p;
+	int		i;
+
+	if (!pty_spawn(&p, big_env))
+	{
+		fprintf(stderr, "%s: ./minishell did not show a prompt\n", name);
+		return ;
+	}
+	i = 0;
+	while (i++ < history)
+		enter_latency(&p, "true");
+	ft_memset(&enter, 0, sizeof(t_bench));
+	ft_memset(&key, 0, sizeof(t_bench));
+	enter.runs = runs;
+	key.runs = runs;
+	enter.samples = malloc(sizeof(double) * runs);
+	key.samples = malloc(sizeof(double) * runs);
+	while (enter.samples && enter.done < runs)
+		if ((enter.samples[enter.done] = enter_latency(&p, "true")) >= 0)
+			enter.done++;
+		else
+			break ;
+	while (key.samples && key.done < runs)
+		if ((key.samples[key.done] = key_latency(&p, key.done)) >= 0)
+			key.done++;
+		else
+			break ;
+	write(p.fd, "\025exit\r", 6);
+	waitpid(p.pid, NULL, 0);
+	close(p.fd);
+	snprintf(line, sizeof(line), "%s: Enter to next prompt", name);
+	enter.line = line;
+	bench_report(&enter);
+	snprintf(line, sizeof(line), "%s: keystroke to echo", name);
+	key.line = line;
+	bench_report(&key);
+	free(enter.samples);
+	free(key.samples);
+}
+
+/*
+** Usage: bench_pty [runs]
+** Drives ./minishell on a pseudo-terminal like a user would: "true" and
+** Enter, timed until the next prompt is drawn, and single keystrokes,
+** timed until readline echoes them. The idle session starts with the
+** inherited environment and no history; the loaded one with
+** PTY_BIG_ENV extra variables and PTY_HISTORY lines typed beforehand.
+*/
+int	main(int ac, char **av)
+{
+	int	runs;
+
+	runs = 2000;
+	if (ac > 1)
+		runs = ft_atoi(av[1]);
+	if (runs < 1)
+		runs = 1;
+	fprintf(stderr, "%s%s=== interactive latency on a pty ===%s\n", BOLD,
+		CYAN, RESET);
+	run_session("idle", 0, 0, runs);
+	run_session("loaded", 1, PTY_HISTORY, runs);
+	return (0);
+}
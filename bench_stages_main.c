@@ -0,0 +1,318 @@
+#include "includes/minishell.h"
+#include <stdio.h>
+
+// ANSI Colors
+#define GREEN   "\033[32m"
+#define RED     "\033[31m"
+#define CYAN    "\033[36m"
+#define BOLD    "\033[1m"
+#define RESET   "\033[0m"
+
+#define STAGE_LEXER 0
+#define STAGE_PARSER 1
+#define STAGE_EXPANDER 2
+#define MIN_SECONDS 0.2
+#define MAX_SECONDS 2.0
+#define WORD_SIZE 16384
+#define BIG_ENV 10000
+
+typedef struct s_corpus {
+	char	*name;
+	char	*line;           // Built by corpus_build()
+	int		big_env;         // 1 to expand against BIG_ENV extra variables
+	int		tokens;
+} t_corpus;
+
+typedef struct s_result {
+	char	corpus[32];
+	char	stage[16];
+	double	lines_per_s;
+	double	ns_per_token;
+} t_result;
+
+static const char	*g_stages[] = {"lexer", "parser", "expander"};
+
+static double	now_s(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+// Repeats piece n times, with sep in between
+static char	*repeat(const char *head, const char *piece, const char *sep,
+		int n)
+{
+	size_t	len;
+	char	*line;
+	char	*p;
+	int		i;
+
+	len = strlen(head) + (strlen(piece) + strlen(sep)) * n + 1;
+	line = malloc(len);
+	if (!line)
+		return (NULL);
+	p = line + sprintf(line, "%s", head);
+	i = 0;
+	while (i < n)
+	{
+		if (i++ > 0)
+			p += sprintf(p, "%s", sep);
+		p += sprintf(p, "%s", piece);
+	}
+	return (line);
+}
+
+static void	corpus_build(t_corpus *c)
+{
+	char	*word;
+
+	if (!strcmp(c->name, "args"))
+		c->line = repeat("echo ", "argument", " ", 1000);
+	else if (!strcmp(c->name, "pipeline"))
+		c->line = repeat("", "cat -e", " | ", 200);
+	else if (!strcmp(c->name, "quotes"))
+		c->line = repeat("echo ", "'a b'\"c $HOME d\"e'f'\"\"g", " ", 300);
+	else if (!strcmp(c->name, "vars") || !strcmp(c->name, "vars_10k"))
+		c->line = repeat("echo ", "$HOME-$USER:$BENCH_5000$NOPE", " ",
+				300);
+	else
+	{
+		word = malloc(WORD_SIZE + 1);
+		if (!word)
+			return ;
+		memset(word, 'w', WORD_SIZE);
+		word[WORD_SIZE] = '\0';
+		c->line = repeat("echo ", word, "", 1);
+		free(word);
+	}
+}
+
+static int	count_tokens(t_token *t)
+{
+	int	n;
+
+	n = 0;
+	while (t && t->type != TOKEN_EOF)
+	{
+		n++;
+		t = t->next;
+	}
+	return (n);
+}
+
+/*
+** Runs one stage over the line until MIN_SECONDS have been spent in it,
+** or MAX_SECONDS in total. Only the stage itself is timed: the lexing
+** and parsing the parser and the expander need (expansion rewrites the
+** AST, so every iteration parses again) happen outside the clock.
+*/
+static double	run_stage(int stage, char *line, t_shell *shell, long *iters)
+{
+	t_token		*tokens;
+	t_ast_node	*ast;
+	double		spent;
+	double		start;
+	double		first;
+
+	spent = 0;
+	*iters = 0;
+	first = now_s();
+	while (spent < MIN_SECONDS && now_s() - first < MAX_SECONDS)
+	{
+		start = now_s();
+		tokens = lexer(line);
+		if (stage == STAGE_LEXER)
+			spent += now_s() - start;
+		start = now_s();
+		ast = parse(tokens);
+		if (stage == STAGE_PARSER)
+			spent += now_s() - start;
+		start = now_s();
+		if (stage == STAGE_EXPANDER && ast)
+			expand_ast(ast, shell);
+		if (stage == STAGE_EXPANDER)
+			spent += now_s() - start;
+		ast_free(ast);
+		token_lstclear(&tokens);
+		(*iters)++;
+	}
+	return (spent);
+}
+
+static void	big_env(t_shell *shell, int add)
+{
+	char	name[32];
+	char	value[32];
+	int		i;
+
+	i = 0;
+	while (i < BIG_ENV)
+	{
+		snprintf(name, sizeof(name), "BENCH_%d", i);
+		snprintf(value, sizeof(value), "value_%d", i);
+		if (add)
+			env_set(shell, name, value, strlen(value));
+		else
+			env_unset(shell, name);
+		i++;
+	}
+}
+
+static int	load_baseline(char *path, t_result *base, int max)
+{
+	FILE	*f;
+	char	buf[256];
+	int		n;
+
+	f = fopen(path, "r");
+	if (!f)
+	{
+		perror(path);
+		return (-1);
+	}
+	n = 0;
+	while (n < max && fgets(buf, sizeof(buf), f))
+	{
+		if (buf[0] == '#')
+			continue ;
+		if (sscanf(buf, "%31s %15s %lf %lf", base[n].corpus, base[n].stage,
+				&base[n].lines_per_s, &base[n].ns_per_token) == 4)
+			n++;
+	}
+	fclose(f);
+	return (n);
+}
+
+// Returns the number of results slower than the baseline by > threshold %
+static int	compare(t_result *res, int n, t_result *base, int nbase,
+		double threshold)
+{
+	double	delta;
+	int		bad;
+	int		i;
+	int		j;
+
+	bad = 0;
+	i = -1;
+	while (++i < n)
+	{
+		j = 0;
+		while (j < nbase && (strcmp(base[j].corpus, res[i].corpus)
+				|| strcmp(base[j].stage, res[i].stage)))
+			j++;
+		if (j == nbase || base[j].ns_per_token <= 0)
+			continue ;
+		delta = (res[i].ns_per_token / base[j].ns_per_token - 1) * 100;
+		fprintf(stderr, "%s%-10s %-9s %+7.1f%%%s\n", delta > threshold
+			? RED : GREEN, res[i].corpus, res[i].stage, delta, RESET);
+		bad += delta > threshold;
+	}
+	return (bad);
+}
+
+/*
+** Usage: bench_stages [-o results] [-b baseline] [-t threshold%]
+** Prints one line per corpus and stage on stdout (and to -o):
+**   corpus stage lines_per_s ns_per_token
+** Lines starting with '#' are comments; the columns never change, so a
+** saved run can be used as a baseline. With -b, every pair slower than
+** the baseline by more than -t percent (default 25) fails the run.
+*/
+int	main(int ac, char **av, char **envp)
+{
+	t_corpus	corpora[] = {{"args", NULL, 0, 0}, {"pipeline", NULL, 0, 0},
+		{"quotes", NULL, 0, 0}, {"vars", NULL, 0, 0},
+		{"vars_10k", NULL, 1, 0}, {"word", NULL, 0, 0}};
+	t_result	res[18];
+	t_result	base[64];
+	t_shell		shell;
+	t_token		*tokens;
+	char		*out_path;
+	char		*base_path;
+	double		threshold;
+	double		secs;
+	long		iters;
+	FILE		*out;
+	int			n;
+	int			i;
+	int			s;
+
+	out_path = NULL;
+	base_path = NULL;
+	threshold = 25;
+	i = 0;
+	while (++i + 1 < ac)
+	{
+		if (!strcmp(av[i], "-o"))
+			out_path = av[++i];
+		else if (!strcmp(av[i], "-b"))
+			base_path = av[++i];
+		else if (!strcmp(av[i], "-t"))
+			threshold = atof(av[++i]);
+	}
+	ft_memset(&shell, 0, sizeof(t_shell));
+	init_shell(envp, &shell);
+	fprintf(stderr, "%s%s=== lexer, parser and expander throughput ===%s\n",
+		BOLD, CYAN, RESET);
+	printf("# corpus stage lines_per_s ns_per_token\n");
+	n = 0;
+	i = -1;
+	while (++i < (int)(sizeof(corpora) / sizeof(*corpora)))
+	{
+		corpus_build(&corpora[i]);
+		if (!corpora[i].line)
+			return (1);
+		tokens = lexer(corpora[i].line);
+		corpora[i].tokens = count_tokens(tokens);
+		token_lstclear(&tokens);
+		if (corpora[i].big_env)
+			big_env(&shell, 1);
+		s = -1;
+		while (++s < 3)
+		{
+			secs = run_stage(s, corpora[i].line, &shell, &iters);
+			snprintf(res[n].corpus, sizeof(res[n].corpus), "%s",
+				corpora[i].name);
+			snprintf(res[n].stage, sizeof(res[n].stage), "%s", g_stages[s]);
+			res[n].lines_per_s = iters / secs;
+			res[n].ns_per_token = secs * 1e9 / iters / corpora[i].tokens;
+			printf("%s %s %.1f %.2f\n", res[n].corpus, res[n].stage,
+				res[n].lines_per_s, res[n].ns_per_token);
+			fflush(stdout);
+			n++;
+		}
+		if (corpora[i].big_env)
+			big_env(&shell, 0);
+		free(corpora[i].line);
+	}
+	if (out_path)
+	{
+		out = fopen(out_path, "w");
+		if (!out)
+			return (perror(out_path), 1);
+		fprintf(out, "# corpus stage lines_per_s ns_per_token\n");
+		i = -1;
+		while (++i < n)
+			fprintf(out, "%s %s %.1f %.2f\n", res[i].corpus, res[i].stage,
+				res[i].lines_per_s, res[i].ns_per_token);
+		fclose(out);
+	}
+	s = 0;
+	if (base_path)
+	{
+		i = load_baseline(base_path, base, 64);
+		if (i < 0)
+			return (1);
+		s = compare(res, n, base, i, threshold);
+		if (s)
+			fprintf(stderr, "%s%d regression(s) above %.0f%%%s\n", RED, s,
+				threshold, RESET);
+	}
+	waitset_free(&shell.children);
+	free(shell.pipestatus);
+	free(shell.cwd.path);
+	env_free(&shell);
+	return (s != 0);
+}
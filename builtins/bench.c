@@ -0,0 +1,119 @@
+#include"../includes/minishell.h"
+
+static int bench_usage(void)
+{
+    ft_putstr_fd("minishell: bench: usage: bench [-n runs] [-w warmup] "
+        "[--] pipeline\n", 2);
+    return (2);
+}
+
+// opcoes: -n N execucoes medidas (10 por defeito), -w N de aquecimento
+static int bench_options(char **args, t_bench *b)
+{
+    int i;
+
+    b->runs = 10;
+    i = 1;
+    while (args[i] && args[i][0] == '-')
+    {
+        if (ft_strcmp(args[i], "--") == 0)
+            return (i + 1);
+        if (ft_strcmp(args[i], "-n") == 0 && args[i + 1])
+            b->runs = ft_atoi(args[++i]);
+        else if (ft_strcmp(args[i], "-w") == 0 && args[i + 1])
+            b->warmup = ft_atoi(args[++i]);
+        else
+            return (-1);
+        if (b->runs < 1 || b->warmup < 0)
+            return (-1);
+        i++;
+    }
+    return (i);
+}
+
+// junta as palavras numa linha, so para o relatorio
+static char *bench_line(char **args)
+{
+    char    *line;
+    char    *tmp;
+    int     i;
+
+    line = ft_strdup(args[0]);
+    i = 1;
+    while (line && args[i])
+    {
+        tmp = ft_charjoin(line, ' ');
+        line = NULL;
+        if (tmp)
+            line = ft_strjoin(tmp, args[i]);
+        free(tmp);
+        i++;
+    }
+    return (line);
+}
+
+// um so argumento e uma linha a ler (bench -- 'ls | wc -l'); varias
+// palavras ja foram expandidas pelo shell e sao o comando tal e qual,
+// sem segundo lexer nem segunda expansao (bench -- touch "a b")
+static t_ast_node *bench_parse(char **args, t_token **tokens, t_shell *shell)
+{
+    t_ast_node  *ast;
+
+    if (args[1])
+    {
+        ast = ast_new_node(NODE_COMMAND);
+        if (ast)
+            ast->args = args_dup(args);
+        if (ast && !ast->args)
+        {
+            ast_free(ast);
+            ast = NULL;
+        }
+        return (ast);
+    }
+    *tokens = lexer(args[0]);
+    ast = parse(*tokens);
+    if (ast && is_list_node(ast->type))
+    {
+        ft_putstr_fd("minishell: bench: only a pipeline can be measured\n", 2);
+        ast_free(ast);
+        return (NULL);
+    }
+    if (ast && !(collect_heredocs(ast, shell) && expand_ast(ast, shell)))
+    {
+        ast_free(ast);
+        return (NULL);
+    }
+    return (ast);
+}
+
+// bench [-n N] [-w N] [--] pipeline: o pipeline e lido uma so vez
+int builtin_bench(t_ast_node *cmd, t_shell *shell)
+{
+    t_bench     b;
+    t_token     *tokens;
+    t_ast_node  *ast;
+    int         i;
+    int         status;
+
+    ft_memset(&b, 0, sizeof(t_bench));
+    i = bench_options(cmd->args, &b);
+    if (i == -1 || !cmd->args[i])
+        return (bench_usage());
+    b.line = bench_line(cmd->args + i);
+    if (!b.line)
+        return (1);
+    tokens = NULL;
+    ast = bench_parse(cmd->args + i, &tokens, shell);
+    status = 2;
+    if (ast)
+    {
+        status = bench_run(&b, ast, shell);
+        bench_report(&b);
+    }
+    ast_free(ast);
+    token_lstclear(&tokens);
+    free(b.samples);
+    free(b.line);
+    return (status);
+}
@@ -1,33 +1,78 @@
 #include"../includes/minishell.h"
 
-int exec_builtin(t_command *cmd, t_mini *ms)
+int is_builtin(char *name)
 {
-    if (!cmd || !cmd->cmd_name)
+    if (!name)
+        return (0);
+    return (!ft_strcmp(name, "echo") || !ft_strcmp(name, "cd")
+        || !ft_strcmp(name, "pwd") || !ft_strcmp(name, "export")
+        || !ft_strcmp(name, "unset") || !ft_strcmp(name, "env")
+        || !ft_strcmp(name, "exit") || !ft_strcmp(name, "jobs")
+        || !ft_strcmp(name, "wait") || !ft_strcmp(name, "pmap")
+        || !ft_strcmp(name, "bench") || !ft_strcmp(name, "test")
+        || !ft_strcmp(name, "[") || !ft_strcmp(name, "true")
+        || !ft_strcmp(name, "false") || !ft_strcmp(name, ":")
+        || !ft_strcmp(name, "cat") || !ft_strcmp(name, "printf")
+        || !ft_strcmp(name, "read") || !ft_strcmp(name, "shellstats"));
+}
+
+int exec_builtin(t_ast_node *cmd, t_shell *shell)
+{
+    if (!cmd || !cmd->args || !cmd->args[0])
         return (1);
-    if (ft_strcmp(cmd->cmd_name, "echo") == 0)
+    shell->stats.builtins++;
+    if (ft_strcmp(cmd->args[0], "echo") == 0)
         return (builtin_echo(cmd));
-    if (ft_strcmp(cmd->cmd_name, "cd") == 0)
-        return (builtin_cd(cmd, ms));
-    if (ft_strcmp(cmd->cmd_name, "pwd") == 0)
-        return (builtin_pwd(cmd));
-    if (ft_strcmp(cmd->cmd_name, "export") == 0)
-        return (builtin_export(cmd, ms));
-    if (ft_strcmp(cmd->cmd_name, "unset") == 0)
-        return (builtin_unset(cmd, ms));
-    if (ft_strcmp(cmd->cmd_name, "env") == 0)
-        return (builtin_env(cmd, ms));
-    if (ft_strcmp(cmd->cmd_name, "exit") == 0)
-        return (builtin_exit(cmd));
+    if (ft_strcmp(cmd->args[0], "cd") == 0)
+        return (builtin_cd(cmd, shell));
+    if (ft_strcmp(cmd->args[0], "pwd") == 0)
+        return (builtin_pwd(cmd, shell));
+    if (ft_strcmp(cmd->args[0], "export") == 0)
+        return (builtin_export(cmd, shell));
+    if (ft_strcmp(cmd->args[0], "unset") == 0)
+        return (builtin_unset(cmd, shell));
+    if (ft_strcmp(cmd->args[0], "env") == 0)
+        return (builtin_env(cmd, shell));
+    if (ft_strcmp(cmd->args[0], "exit") == 0)
+        return (builtin_exit(cmd, shell));
+    if (ft_strcmp(cmd->args[0], "jobs") == 0)
+        return (builtin_jobs(cmd, shell));
+    if (ft_strcmp(cmd->args[0], "wait") == 0)
+        return (builtin_wait(cmd, shell));
+    if (ft_strcmp(cmd->args[0], "pmap") == 0)
+        return (builtin_pmap(cmd, shell));
+    if (ft_strcmp(cmd->args[0], "bench") == 0)
+        return (builtin_bench(cmd, shell));
+    if (ft_strcmp(cmd->args[0], "test") == 0
+        || ft_strcmp(cmd->args[0], "[") == 0)
+        return (builtin_test(cmd));
+    if (ft_strcmp(cmd->args[0], "true") == 0
+        || ft_strcmp(cmd->args[0], ":") == 0)
+        return (0);
+    if (ft_strcmp(cmd->args[0], "false") == 0)
+        return (1);
+    if (ft_strcmp(cmd->args[0], "cat") == 0)
+        return (builtin_cat(cmd, shell));
+    if (ft_strcmp(cmd->args[0], "printf") == 0)
+        return (builtin_printf(cmd));
+    if (ft_strcmp(cmd->args[0], "read") == 0)
+        return (builtin_read(cmd, shell));
+    if (ft_strcmp(cmd->args[0], "shellstats") == 0)
+        return (builtin_shellstats(cmd, shell));
     return (1);
 }
 
-pid_t	control_fork()
+// o que o stdio ainda tem em buffer sairia duas vezes (pai e filho)
+pid_t	control_fork(void)
 {
 	pid_t	pid;
 	
+	fflush(stdout);
 	pid = fork();
 	if (-1 == pid)
 		perror("minishell: fork");
+	else if (pid > 0)
+		PROBE1(cmd_spawn, pid);
 	return (pid);
 }
 
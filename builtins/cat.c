@@ -0,0 +1,95 @@
+#include"../includes/minishell.h"
+#include <sys/stat.h>
+
+static int cat_error(char *name, char *msg)
+{
+    ft_putstr_fd("minishell: cat: ", 2);
+    ft_putstr_fd(name, 2);
+    ft_putstr_fd(": ", 2);
+    ft_putstr_fd(msg, 2);
+    ft_putstr_fd("\n", 2);
+    return (1);
+}
+
+// opcoes que o builtin nao trata (-n, -A...) vao para o cat externo
+static int cat_external(t_ast_node *cmd, t_shell *shell)
+{
+    pid_t   pid;
+
+    pid = -1;
+    setup_exec_signals();
+    if (waitset_reserve(&shell->children, 1))
+        pid = control_fork();
+    if (pid == -1)
+        return (1);
+    if (pid == 0)
+    {
+        reset_child_signals();
+        exec_command(cmd->args, shell);
+    }
+    return (spawn_wait(shell, pid));
+}
+
+// "-" e o stdin; recusa copiar um ficheiro para ele proprio. Um Ctrl-C
+// acaba a copia com 130
+static int cat_file(char *name)
+{
+    struct stat in_st;
+    struct stat out_st;
+    int         fd;
+    int         ok;
+
+    fd = STDIN_FILENO;
+    if (ft_strcmp(name, "-"))
+        fd = open(name, O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+        return (cat_error(name, strerror(errno)));
+    if (fstat(fd, &in_st) == 0 && fstat(STDOUT_FILENO, &out_st) == 0
+        && S_ISREG(in_st.st_mode) && S_ISREG(out_st.st_mode)
+        && in_st.st_dev == out_st.st_dev && in_st.st_ino == out_st.st_ino)
+    {
+        if (fd != STDIN_FILENO)
+            close(fd);
+        return (cat_error(name, "input file is output file"));
+    }
+    ok = copy_fd(fd, STDOUT_FILENO);
+    if (!ok && errno == EINTR)
+        ok = -1;
+    else if (!ok)
+        cat_error(name, strerror(errno));
+    if (fd != STDIN_FILENO)
+        close(fd);
+    if (ok == -1)
+        return (128 + SIGINT);
+    return (!ok);
+}
+
+// cat [-u] [file...]: copia sem passar pelo user space quando da
+int builtin_cat(t_ast_node *cmd, t_shell *shell)
+{
+    int i;
+    int ok;
+    int status;
+
+    i = 1;
+    while (cmd->args[i] && cmd->args[i][0] == '-' && cmd->args[i][1])
+    {
+        if (ft_strcmp(cmd->args[i], "--") == 0 && ++i)
+            break ;
+        if (ft_strcmp(cmd->args[i], "-u"))
+            return (cat_external(cmd, shell));
+        i++;
+    }
+    fflush(stdout);
+    if (!cmd->args[i])
+        return (cat_file("-"));
+    status = 0;
+    while (cmd->args[i])
+    {
+        ok = cat_file(cmd->args[i++]);
+        if (ok == 128 + SIGINT)
+            return (ok);
+        status |= ok;
+    }
+    return (status);
+}
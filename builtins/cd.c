@@ -1,33 +1,98 @@
 #include"../includes/minishell.h"
 
-int builtin_cd(t_command *cmd, t_mini *ms)
+static int cd_error(char *arg, char *msg)
 {
-    char *path;
-    
-    if (cmd->arg_count == 1)
-    {
-        path = mini_getenv("HOME", ms->envp);
-        if (!path)
-        {
-            fprintf(stderr, "minishell: cd: HOME not set\n");
-            return (1);
-        }
-    }
-    else if (cmd->arg_count == 2)
+    ft_putstr_fd("minishell: cd: ", 2);
+    if (arg)
     {
-        path = cmd->args[1];
+        ft_putstr_fd(arg, 2);
+        ft_putstr_fd(": ", 2);
     }
-    else
+    ft_putstr_fd(msg, 2);
+    ft_putstr_fd("\n", 2);
+    return (1);
+}
+
+// -L (padrao) e -P; devolve o indice do primeiro operando ou -1
+static int cd_options(char **args, int *physical)
+{
+    int i;
+
+    i = 1;
+    while (args[i] && args[i][0] == '-' && args[i][1])
     {
-        fprintf(stderr, "minishell: cd: too many arguments\n");
-        return (1);
+        if (!ft_strcmp(args[i], "--"))
+            return (i + 1);
+        if (!ft_strcmp(args[i], "-P"))
+            *physical = 1;
+        else if (!ft_strcmp(args[i], "-L"))
+            *physical = 0;
+        else
+        {
+            cd_error(args[i], "invalid option");
+            ft_putstr_fd("cd: usage: cd [-L|-P] [dir]\n", 2);
+            return (-1);
+        }
+        i++;
     }
-    
-    if (chdir(path) == -1)
+    return (i);
+}
+
+// no modo logico o caminho e resolvido a partir do PWD guardado, sem
+// getcwd; no fisico e o kernel que diz onde ficamos
+static int cd_go(t_shell *shell, char *path, int physical)
+{
+    char *target;
+
+    target = NULL;
+    if (!physical && shell->cwd.path)
     {
-        perror("minishell: cd");
-        return (1);
+        target = cwd_canon(shell->cwd.path, path);
+        if (!target)
+            return (cd_error(path, strerror(errno)));
+        if (chdir(target) == -1)
+            return (free(target), cd_error(path, strerror(errno)));
     }
-    
+    else if (chdir(path) == -1)
+        return (cd_error(path, strerror(errno)));
+    if (!target)
+        target = getcwd(NULL, 0);
+    if (!target)
+        return (cd_error(path, strerror(errno)));
+    cwd_set(shell, target);
     return (0);
+}
+
+int builtin_cd(t_ast_node *cmd, t_shell *shell)
+{
+    t_outbuf    ob;
+    char *path;
+    int  physical;
+    int  i;
+    
+    physical = 0;
+    i = cd_options(cmd->args, &physical);
+    if (i == -1)
+        return (2);
+    if (cmd->args[i] && cmd->args[i + 1])
+        return (cd_error(NULL, "too many arguments"));
+    path = cmd->args[i];
+    if (!path && !get_env_value("HOME", shell))
+        return (cd_error(NULL, "HOME not set"));
+    if (!path)
+        path = get_env_value("HOME", shell);
+    else if (!ft_strcmp(path, "-") && !get_env_value("OLDPWD", shell))
+        return (cd_error(NULL, "OLDPWD not set"));
+    if (!*path)
+        return (0);
+    if (ft_strcmp(path, "-"))
+        return (cd_go(shell, path, physical));
+    path = ft_strdup(get_env_value("OLDPWD", shell));
+    if (!path || cd_go(shell, path, physical))
+        return (free(path), 1);
+    free(path);
+    outbuf_init(&ob, 1);
+    outbuf_puts(&ob, shell->cwd.path);
+    outbuf_putc(&ob, '\n');
+    return (builtin_write_error("cd", &ob));
 }
\ No newline at end of file
@@ -1,27 +1,42 @@
 #include"../includes/minishell.h"
 
-int builtin_echo(t_command *cmd)
+// o output fica num t_outbuf e sai num so write (echo e printf)
+int builtin_write_error(char *name, t_outbuf *ob)
 {
+    if (outbuf_flush(ob))
+        return (0);
+    ft_putstr_fd("minishell: ", 2);
+    ft_putstr_fd(name, 2);
+    ft_putstr_fd(": write error: ", 2);
+    ft_putstr_fd(strerror(ob->error), 2);
+    ft_putstr_fd("\n", 2);
+    return (1);
+}
+
+int builtin_echo(t_ast_node *cmd)
+{
+    t_outbuf    ob;
     int  i;
     int  n;
     
     n = 1;
     i = 1;
     
-    if (cmd->args[0] && !ft_strcmp(cmd->args[i], "-n"))
+    if (cmd->args[i] && !ft_strcmp(cmd->args[i], "-n"))
     {
         n = 0;
         i++;
     }
+    outbuf_init(&ob, 1);
     while (cmd->args[i])
     {
-        ft_putstr_fd(cmd->args[i], 1);
+        outbuf_puts(&ob, cmd->args[i]);
         if (cmd->args[i + 1])
-            ft_putchar_fd(' ', 1);
+            outbuf_putc(&ob, ' ');
         i++;
     }
     if (n)
-        ft_putchar_fd('\n', 1);
+        outbuf_putc(&ob, '\n');
     
-    return (0);
-}
\ No newline at end of file
+    return (builtin_write_error("echo", &ob));
+}
@@ -1,13 +1,18 @@
 #include"../includes/minishell.h"
 
-int builtin_env(t_command *cmd, t_mini *ms)
+int builtin_env(t_ast_node *cmd, t_shell *shell)
 {
+    t_outbuf    ob;
     int i = 0;
     
     (void)cmd;
     
-    while (ms->envp[i])
-        printf("%s\n", ms->envp[i++]);
+    outbuf_init(&ob, 1);
+    while (shell->envp[i])
+    {
+        outbuf_puts(&ob, shell->envp[i++]);
+        outbuf_putc(&ob, '\n');
+    }
     
-    return (0);
+    return (builtin_write_error("env", &ob));
 }
\ No newline at end of file
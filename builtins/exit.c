@@ -1,12 +1,17 @@
 #include"../includes/minishell.h"
 
-int builtin_exit(t_command *cmd)
+int builtin_exit(t_ast_node *cmd, t_shell *shell)
 {
-    int exit_code = 0;
+    int exit_code = shell->exit_status;
     
-    if (cmd->arg_count > 1)
-        exit_code = atoi(cmd->args[1]);
+    if (args_count(cmd->args) > 1)
+        exit_code = ft_atoi(cmd->args[1]);
     
-    printf("exit\n");
+    ft_putstr_fd("exit\n", 1);
+    trace_dump(shell);
+    // a linha do exit nao volta ao shell_loop: regista-a aqui
+    shell->exit_status = (unsigned char)exit_code;
+    audit_record(shell, shell->line);
+    audit_close(shell);
     exit(exit_code);
 }
\ No newline at end of file
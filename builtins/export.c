@@ -1,78 +1,38 @@
-
 #include "../includes/minishell.h"
 
-static int find_var(char **envp, char *name)
-{
-	int i;
-	int len;
-
-	len = 0;
-	i = 0;
-	while (name[len] && name[len] != '=')
-		len++;
-	while (envp[i])
-	{
-		if (!ft_strncmp(envp[i], name, len) && envp[i][len] == '=')
-			return (i);
-		i++;
-	}
-	return (-1);
-}
-
-static int add_var(t_mini *ms, char *arg)
+// lista pela ordem do indice: ja vem ordenado por nome, sem sort
+static int print_vars(t_shell *shell)
 {
-	int i;
-	char **new_envp;
+	t_outbuf	ob;
+	int			i;
 
+	outbuf_init(&ob, 1);
 	i = 0;
-	while (ms->envp[i])
-		i++;
-	new_envp = (char **)malloc(sizeof(char *) * (i + 2));
-	if (!new_envp)
-		return (1);
-	i = 0;
-	while (ms->envp[i])
+	while (i < shell->env.len)
 	{
-		new_envp[i] = ms->envp[i];
+		outbuf_write(&ob, "declare -x ", 11);
+		outbuf_puts(&ob, shell->envp[shell->env.order[i]]);
+		outbuf_putc(&ob, '\n');
 		i++;
 	}
-	new_envp[i] = ft_strdup(arg);
-	new_envp[i + 1] = NULL;
-	free(ms->envp);
-	ms->envp = new_envp;
-	return (0);
+	return (builtin_write_error("export", &ob));
 }
 
-int builtin_export(t_command *cmd, t_mini *ms)
+int builtin_export(t_ast_node *cmd, t_shell *shell)
 {
 	int i;
-	int pos;
+	char *entry;
 
 	i = 1;
-	if (cmd->arg_count < 2)
-	{
-		i = 0;
-		while (ms->envp[i])
-		{
-			ft_putstr_fd("declare -x ", 1);
-			ft_putstr_fd(ms->envp[i], 1);
-			ft_putchar_fd('\n', 1);
-			i++;
-		}
-		return (0);
-	}
+	if (args_count(cmd->args) < 2)
+		return (print_vars(shell));
 	while (cmd->args[i])
 	{
 		if (ft_strchr(cmd->args[i], '='))
 		{
-			pos = find_var(ms->envp, cmd->args[i]);
-			if (pos >= 0)
-			{
-				free(ms->envp[pos]);
-				ms->envp[pos] = ft_strdup(cmd->args[i]);
-			}
-			else
-				add_var(ms, cmd->args[i]);
+			entry = ft_strdup(cmd->args[i]);
+			if (!entry || !env_put(shell, entry))
+				return (free(entry), perror("minishell: export"), 1);
 		}
 		i++;
 	}
@@ -0,0 +1,20 @@
+#include"../includes/minishell.h"
+
+int builtin_jobs(t_ast_node *cmd, t_shell *shell)
+{
+    t_job   *job;
+    t_job   *next;
+
+    (void)cmd;
+    job = shell->jobs;
+    while (job)
+    {
+        next = job->next;
+        waitset_wait(&shell->children, job->slots, job->n, 0);
+        job_print(shell, job);
+        if (waitset_running(&shell->children, job->slots, job->n) == 0)
+            job_finish(shell, job);
+        job = next;
+    }
+    return (0);
+}
@@ -0,0 +1,65 @@
+#include"../includes/minishell.h"
+
+static int pmap_usage(void)
+{
+    ft_putstr_fd("minishell: pmap: usage: pmap [-k] [-j jobs] cmd [args] "
+        "[::: items]\n", 2);
+    return (2);
+}
+
+// opcoes: -k mantem a ordem do output, -j N limita os processos
+// (por defeito um por CPU online)
+static int pmap_options(char **args, t_pmap *p)
+{
+    int i;
+
+    p->jobs = sysconf(_SC_NPROCESSORS_ONLN);
+    if (p->jobs < 1)
+        p->jobs = 1;
+    i = 1;
+    while (args[i] && args[i][0] == '-')
+    {
+        if (ft_strcmp(args[i], "--") == 0)
+            return (i + 1);
+        if (ft_strcmp(args[i], "-k") == 0)
+            p->keep_order = 1;
+        else if (ft_strcmp(args[i], "-j") == 0 && args[i + 1])
+        {
+            p->jobs = ft_atoi(args[++i]);
+            if (p->jobs < 1)
+                return (-1);
+        }
+        else
+            return (-1);
+        i++;
+    }
+    return (i);
+}
+
+// pmap [-k] [-j N] cmd args {} ::: item...  (sem ::: le os items do stdin)
+int builtin_pmap(t_ast_node *cmd, t_shell *shell)
+{
+    t_pmap  p;
+    int     i;
+    int     status;
+
+    ft_memset(&p, 0, sizeof(t_pmap));
+    i = pmap_options(cmd->args, &p);
+    if (i == -1 || !cmd->args[i] || ft_strcmp(cmd->args[i], ":::") == 0)
+        return (pmap_usage());
+    p.tmpl = cmd->args + i;
+    while (p.tmpl[p.tmpl_len] && ft_strcmp(p.tmpl[p.tmpl_len], ":::"))
+        p.tmpl_len++;
+    p.items = p.tmpl + p.tmpl_len;
+    if (*p.items)
+        p.count = args_count(++p.items);
+    else if (!pmap_read_items(&p))
+        return (perror("minishell: pmap"), 1);
+    setup_wait_signals();
+    status = 0;
+    if (p.count > 0)
+        status = pmap_run(&p, shell);
+    if (p.items_owned)
+        free_args(p.items);
+    return (status);
+}
@@ -0,0 +1,154 @@
+#include"../includes/minishell.h"
+
+// flags, largura e precisao; '*' vai buscar o valor ao proximo argumento
+static char *printf_spec(t_printf *p, char *s)
+{
+    int i;
+
+    i = 0;
+    while (*s && ft_strchr("-0+ #", *s))
+    {
+        if (i < 5 && !ft_strchr(p->flags, *s))
+            p->flags[i++] = *s;
+        s++;
+    }
+    p->flags[i] = '\0';
+    p->width = 0;
+    if (*s == '*' && s++)
+        p->width = p->args[p->argi] ? ft_atoi(p->args[p->argi++]) : 0;
+    while (ft_isdigit(*s))
+        p->width = p->width * 10 + *s++ - '0';
+    p->prec = -1;
+    if (*s != '.')
+        return (s);
+    p->prec = 0;
+    if (*++s == '*' && s++)
+        p->prec = p->args[p->argi] ? ft_atoi(p->args[p->argi++]) : 0;
+    while (ft_isdigit(*s))
+        p->prec = p->prec * 10 + *s++ - '0';
+    return (s);
+}
+
+// %b: o argumento com os escapes expandidos; \c acaba com o output todo
+static void printf_b(t_printf *p, char *arg)
+{
+    char    *out;
+    size_t  len;
+    int     i;
+    int     n;
+
+    out = malloc(ft_strlen(arg) + 1);
+    if (!out)
+        return ;
+    len = 0;
+    i = 0;
+    while (arg[i] && !p->stop)
+    {
+        if (arg[i] != '\\')
+        {
+            out[len++] = arg[i++];
+            continue ;
+        }
+        n = printf_escape(arg + i + 1, 1, out + len);
+        p->stop = (n == -1);
+        len += !p->stop;
+        i += n + 1;
+    }
+    printf_string(p, out, len);
+    free(out);
+}
+
+static void printf_conv(t_printf *p, char conv)
+{
+    char    *arg;
+
+    arg = "";
+    if (p->args[p->argi])
+        arg = p->args[p->argi++];
+    if (conv == 's')
+        printf_string(p, arg, ft_strlen(arg));
+    else if (conv == 'c')
+        printf_string(p, arg, arg[0] != '\0');
+    else if (conv == 'b')
+        printf_b(p, arg);
+    else
+        printf_number(p, conv, arg);
+}
+
+static int printf_invalid(char conv)
+{
+    ft_putstr_fd("minishell: printf: `", 2);
+    ft_putchar_fd('%', 2);
+    if (!conv)
+        return (ft_putstr_fd("': missing format character\n", 2), 0);
+    ft_putchar_fd(conv, 2);
+    ft_putstr_fd("': invalid format character\n", 2);
+    return (0);
+}
+
+// uma passagem pelo formato; 0 se o formato e invalido
+static int printf_format(t_printf *p, char *fmt)
+{
+    char    c;
+    int     n;
+
+    while (*fmt && !p->stop)
+    {
+        if (*fmt == '\\')
+        {
+            n = printf_escape(fmt + 1, 0, &c);
+            p->stop = (n == -1);
+            if (!p->stop)
+                outbuf_putc(&p->ob, c);
+            fmt += n + 1;
+        }
+        else if (fmt[0] == '%' && fmt[1] == '%')
+        {
+            outbuf_putc(&p->ob, '%');
+            fmt += 2;
+        }
+        else if (*fmt == '%')
+        {
+            fmt = printf_spec(p, fmt + 1);
+            if (!*fmt || !ft_strchr("sbcdiouxX", *fmt))
+                return (printf_invalid(*fmt));
+            printf_conv(p, *fmt++);
+        }
+        else
+            outbuf_putc(&p->ob, *fmt++);
+    }
+    return (1);
+}
+
+// printf format [args]: o formato repete-se enquanto houver argumentos
+int builtin_printf(t_ast_node *cmd)
+{
+    t_printf    p;
+    char        **args;
+    int         start;
+    int         ok;
+
+    args = cmd->args + 1;
+    if (args[0] && !ft_strcmp(args[0], "--"))
+        args++;
+    if (!args[0])
+    {
+        ft_putstr_fd("printf: usage: printf format [arguments]\n", 2);
+        return (2);
+    }
+    outbuf_init(&p.ob, 1);
+    p.args = args + 1;
+    p.argi = 0;
+    p.status = 0;
+    p.stop = 0;
+    ok = 1;
+    start = -1;
+    while (ok && !p.stop && start < p.argi && (start == -1 || p.args[p.argi]))
+    {
+        start = p.argi;
+        ok = printf_format(&p, args[0]);
+    }
+    if (builtin_write_error("printf", &p.ob) || !ok)
+        return (1);
+    return (p.status);
+}
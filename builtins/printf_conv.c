@@ -0,0 +1,83 @@
+#include"../includes/minishell.h"
+
+// \NNN no formato, \0NNN (ou \NNN) no %b: ate 3 digitos octais
+static int escape_octal(char *s, int in_arg, char *out)
+{
+    int i;
+    int skip;
+
+    skip = (in_arg && s[0] == '0');
+    i = skip;
+    *out = 0;
+    while (i < skip + 3 && s[i] >= '0' && s[i] <= '7')
+        *out = *out * 8 + s[i++] - '0';
+    return (i);
+}
+
+static int hex_value(char c)
+{
+    if (c >= '0' && c <= '9')
+        return (c - '0');
+    if (c >= 'a' && c <= 'f')
+        return (c - 'a' + 10);
+    if (c >= 'A' && c <= 'F')
+        return (c - 'A' + 10);
+    return (-1);
+}
+
+// \xHH: ate 2 digitos hexadecimais
+static int escape_hex(char *s, char *out)
+{
+    int i;
+
+    i = 1;
+    *out = 0;
+    while (i < 3 && hex_value(s[i]) != -1)
+        *out = *out * 16 + hex_value(s[i++]);
+    if (i == 1)
+        return (*out = '\\', 0);
+    return (i);
+}
+
+// s aponta depois da '\'; devolve quantos chars consumiu, -1 para \c
+// (0 se o escape nao existe: a '\' sai tal como esta)
+int printf_escape(char *s, int in_arg, char *out)
+{
+    char    *from;
+    char    *to;
+    char    *pos;
+
+    from = "abfnrtv\\\"'";
+    to = "\a\b\f\n\r\t\v\\\"'";
+    pos = NULL;
+    if (*s)
+        pos = ft_strchr(from, *s);
+    if (pos)
+        return (*out = to[pos - from], 1);
+    if (*s == 'c')
+        return (-1);
+    if (*s >= '0' && *s <= '7')
+        return (escape_octal(s, in_arg, out));
+    if (*s == 'x')
+        return (escape_hex(s, out));
+    *out = '\\';
+    return (0);
+}
+
+static void printf_pad(t_printf *p, int n, char c)
+{
+    while (n-- > 0)
+        outbuf_putc(&p->ob, c);
+}
+
+// %s, %c e %b: a precisao corta, a largura alinha (a esquerda com '-')
+void printf_string(t_printf *p, char *str, size_t len)
+{
+    if (p->prec >= 0 && (size_t)p->prec < len)
+        len = p->prec;
+    if (!ft_strchr(p->flags, '-'))
+        printf_pad(p, p->width - (int)len, ' ');
+    outbuf_write(&p->ob, str, len);
+    if (ft_strchr(p->flags, '-'))
+        printf_pad(p, p->width - (int)len, ' ');
+}
@@ -0,0 +1,114 @@
+#include"../includes/minishell.h"
+
+static int printf_bad_number(t_printf *p, char *arg, char *msg)
+{
+    ft_putstr_fd("minishell: printf: ", 2);
+    ft_putstr_fd(arg, 2);
+    ft_putstr_fd(": ", 2);
+    ft_putstr_fd(msg, 2);
+    ft_putstr_fd("\n", 2);
+    p->status = 1;
+    return (0);
+}
+
+// base 0 como o strtol (0x.., 0..); 'c ou "c da o codigo do caracter
+static unsigned long long printf_value(t_printf *p, char *arg, int is_signed)
+{
+    unsigned long long  v;
+    char                *end;
+
+    if ((arg[0] == '\'' || arg[0] == '"') && arg[1])
+        return ((unsigned char)arg[1]);
+    if (!arg[0])
+        return (0);
+    errno = 0;
+    if (is_signed)
+        v = (unsigned long long)strtoll(arg, &end, 0);
+    else
+        v = strtoull(arg, &end, 0);
+    if (*end || end == arg)
+        printf_bad_number(p, arg, "invalid number");
+    else if (errno == ERANGE)
+        printf_bad_number(p, arg, strerror(errno));
+    return (v);
+}
+
+static int printf_digits(unsigned long long v, char conv, char *buf)
+{
+    char    tmp[32];
+    char    *set;
+    int     base;
+    int     len;
+    int     i;
+
+    base = 10;
+    if (conv == 'o')
+        base = 8;
+    else if (conv == 'x' || conv == 'X')
+        base = 16;
+    set = "0123456789abcdef";
+    if (conv == 'X')
+        set = "0123456789ABCDEF";
+    len = 0;
+    tmp[len++] = set[v % base];
+    while (v / base > 0 && len < 32)
+    {
+        v /= base;
+        tmp[len++] = set[v % base];
+    }
+    i = 0;
+    while (i < len)
+    {
+        buf[i] = tmp[len - 1 - i];
+        i++;
+    }
+    return (len);
+}
+
+static void printf_fill(t_printf *p, int n, char c)
+{
+    while (n-- > 0)
+        outbuf_putc(&p->ob, c);
+}
+
+// %d %i %o %u %x %X: sinal/prefixo, zeros da precisao (ou do flag 0),
+// depois a largura
+void printf_number(t_printf *p, char conv, char *arg)
+{
+    unsigned long long  v;
+    char                digits[32];
+    char                *prefix;
+    int                 len;
+    int                 zeros;
+
+    v = printf_value(p, arg, conv == 'd' || conv == 'i');
+    prefix = "";
+    if ((conv == 'd' || conv == 'i') && (long long)v < 0)
+        prefix = "-";
+    if (*prefix == '-')
+        v = 0 - v;
+    else if ((conv == 'd' || conv == 'i') && ft_strchr(p->flags, '+'))
+        prefix = "+";
+    else if ((conv == 'd' || conv == 'i') && ft_strchr(p->flags, ' '))
+        prefix = " ";
+    else if (ft_strchr(p->flags, '#') && v && conv == 'x')
+        prefix = "0x";
+    else if (ft_strchr(p->flags, '#') && v && conv == 'X')
+        prefix = "0X";
+    len = printf_digits(v, conv, digits) * !(p->prec == 0 && v == 0);
+    zeros = p->prec - len;
+    if (conv == 'o' && ft_strchr(p->flags, '#') && zeros <= 0
+        && (len == 0 || digits[0] != '0'))
+        zeros = 1;
+    if (zeros < 0)
+        zeros = 0;
+    if (ft_strchr(p->flags, '0') && !ft_strchr(p->flags, '-') && p->prec < 0)
+        zeros = p->width - (int)ft_strlen(prefix) - len;
+    if (!ft_strchr(p->flags, '-'))
+        printf_fill(p, p->width - (int)ft_strlen(prefix) - zeros - len, ' ');
+    outbuf_puts(&p->ob, prefix);
+    printf_fill(p, zeros, '0');
+    outbuf_write(&p->ob, digits, len);
+    if (ft_strchr(p->flags, '-'))
+        printf_fill(p, p->width - (int)ft_strlen(prefix) - zeros - len, ' ');
+}
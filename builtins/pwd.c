@@ -1,19 +1,45 @@
 #include "../includes/minishell.h"
 
-int builtin_pwd(t_command *cmd)
+// -L (padrao) imprime o PWD guardado pelo cd; -P pergunta ao kernel
+int builtin_pwd(t_ast_node *cmd, t_shell *shell)
 {
+    t_outbuf    ob;
     char *cwd;
+    int  physical;
+    int  i;
     
-    (void)cmd;
+    physical = 0;
+    i = 1;
+    while (cmd->args[i] && cmd->args[i][0] == '-' && cmd->args[i][1])
+    {
+        if (!ft_strcmp(cmd->args[i], "-P"))
+            physical = 1;
+        else if (!ft_strcmp(cmd->args[i], "-L"))
+            physical = 0;
+        else if (ft_strcmp(cmd->args[i], "--"))
+        {
+            ft_putstr_fd("minishell: pwd: ", 2);
+            ft_putstr_fd(cmd->args[i], 2);
+            ft_putstr_fd(": invalid option\npwd: usage: pwd [-LP]\n", 2);
+            return (2);
+        }
+        i++;
+    }
     
-    cwd = getcwd(NULL, 0);
+    if (physical)
+        cwd = getcwd(NULL, 0);
+    else
+        cwd = cwd_get(shell);
     if (!cwd)
     {
         perror("minishell: pwd");
         return (1);
     }
     
-    printf("%s\n", cwd);
-    free(cwd);
-    return (0);
+    outbuf_init(&ob, 1);
+    outbuf_puts(&ob, cwd);
+    outbuf_putc(&ob, '\n');
+    if (physical)
+        free(cwd);
+    return (builtin_write_error("pwd", &ob));
 }
\ No newline at end of file
@@ -0,0 +1,214 @@
+#include"../includes/minishell.h"
+
+static int read_space(t_read *r, char c)
+{
+    return ((c == ' ' || c == '\t' || c == '\n') && ft_strchr(r->ifs, c));
+}
+
+static int read_ifs(t_read *r, char c)
+{
+    return (c != '\0' && ft_strchr(r->ifs, c));
+}
+
+// salta o separador depois de um campo: espacos do IFS e no maximo um
+// outro caractere do IFS
+static void read_skip(t_read *r)
+{
+    while (r->i < r->len && read_space(r, r->line[r->i]))
+        r->i++;
+    if (r->i < r->len && read_ifs(r, r->line[r->i]))
+    {
+        r->i++;
+        while (r->i < r->len && read_space(r, r->line[r->i]))
+            r->i++;
+    }
+}
+
+// proximo campo, tirando as barras no proprio buffer; o ultimo nome fica
+// com o resto da linha sem os espacos do IFS no fim
+static size_t read_field(t_read *r, int last, char **field)
+{
+    size_t  w;
+    size_t  keep;
+
+    while (r->i < r->len && read_space(r, r->line[r->i]))
+        r->i++;
+    *field = r->line + r->i;
+    w = r->i;
+    keep = w;
+    while (r->i < r->len && (last || !read_ifs(r, r->line[r->i])))
+    {
+        if (r->line[r->i] == '\\' && !r->raw)
+        {
+            if (++r->i < r->len && r->line[r->i] != '\n')
+                r->line[w++] = r->line[r->i];
+            r->i += (r->i < r->len);
+            keep = w;
+            continue ;
+        }
+        r->line[w++] = r->line[r->i++];
+    }
+    while (last && w > keep && read_space(r, r->line[w - 1]))
+        w--;
+    if (!last)
+        read_skip(r);
+    return (w - (*field - r->line));
+}
+
+static int read_join(char **joined, size_t *jlen, char *s, size_t n)
+{
+    char    *tmp;
+
+    tmp = malloc(*jlen + n);
+    if (!tmp)
+        return (0);
+    if (*jlen > 0)
+        ft_memcpy(tmp, *joined, *jlen);
+    ft_memcpy(tmp + *jlen, s, n);
+    free(*joined);
+    *joined = tmp;
+    *jlen += n;
+    return (1);
+}
+
+// sem -r, uma barra antes do delimitador continua a linha: as linhas sao
+// juntadas com a barra e o delimitador, que read_field tira depois
+static int read_line(t_read *r, t_shell *shell, char **joined)
+{
+    size_t  jlen;
+    size_t  n;
+    int     status;
+
+    jlen = 0;
+    status = readbuf_line(&shell->readbuf, 0, &r->line, &r->len);
+    while (status == 1 && !r->raw)
+    {
+        n = 0;
+        while (n < r->len && r->line[r->len - 1 - n] == '\\')
+            n++;
+        if (n % 2 == 0)
+            break ;
+        if (!read_join(joined, &jlen, r->line, r->len + 1))
+            return (-1);
+        status = readbuf_line(&shell->readbuf, 0, &r->line, &r->len);
+    }
+    if (*joined && status >= 0)
+    {
+        if (!read_join(joined, &jlen, r->line, r->len))
+            return (-1);
+        r->line = *joined;
+        r->len = jlen;
+    }
+    return (status);
+}
+
+static int read_name_ok(char *name)
+{
+    int i;
+
+    if (!ft_isalpha(name[0]) && name[0] != '_')
+        return (0);
+    i = 1;
+    while (ft_isalnum(name[i]) || name[i] == '_')
+        i++;
+    return (name[i] == '\0');
+}
+
+static int read_error(char *arg, char *msg, int usage)
+{
+    ft_putstr_fd("minishell: read: ", 2);
+    ft_putstr_fd(arg, 2);
+    ft_putstr_fd(msg, 2);
+    if (usage)
+        ft_putstr_fd("read: usage: read [-r] [-d delim] [name ...]\n", 2);
+    return (1);
+}
+
+// -r e -d delim, juntos ou separados (-rd, -d:, -d '')
+static int read_options(char **av, int *i, t_read *r, t_shell *shell)
+{
+    int j;
+
+    while (av[*i] && av[*i][0] == '-' && av[*i][1])
+    {
+        if (!ft_strcmp(av[*i], "--"))
+            return ((*i)++, 0);
+        j = 1;
+        while (av[*i][j] && av[*i][j] != 'd')
+        {
+            if (av[*i][j++] != 'r')
+                return (read_error(av[*i], ": invalid option\n", 1));
+            r->raw = 1;
+        }
+        if (av[*i][j] == 'd' && av[*i][j + 1])
+            shell->readbuf.delim = av[*i][j + 1];
+        else if (av[*i][j] == 'd' && !av[*i + 1])
+            return (read_error("-d", ": option requires an argument\n", 1));
+        else if (av[*i][j] == 'd')
+            shell->readbuf.delim = av[++(*i)][0];
+        (*i)++;
+    }
+    return (0);
+}
+
+static int read_assign(t_read *r, char **names, t_shell *shell)
+{
+    char    *field;
+    size_t  len;
+    int     i;
+
+    i = 0;
+    while (names[i])
+    {
+        len = read_field(r, names[i + 1] == NULL, &field);
+        if (!env_set(shell, names[i], field, len))
+            return (0);
+        i++;
+    }
+    return (1);
+}
+
+// read [-r] [-d delim] [name ...]: 0 com uma linha inteira, 1 no fim,
+// 130 se o Ctrl-C o interromper
+int builtin_read(t_ast_node *cmd, t_shell *shell)
+{
+    t_read  r;
+    char    *reply[2];
+    char    **names;
+    char    *joined;
+    int     status;
+    int     i;
+
+    ft_memset(&r, 0, sizeof(t_read));
+    shell->readbuf.delim = '\n';
+    i = 1;
+    if (read_options(cmd->args, &i, &r, shell))
+        return (2);
+    names = cmd->args + i;
+    r.ifs = get_env_value("IFS", shell);
+    if (!r.ifs)
+        r.ifs = " \t\n";
+    if (!*names)
+    {
+        reply[0] = "REPLY";
+        reply[1] = NULL;
+        names = reply;
+        r.ifs = "";
+    }
+    i = 0;
+    while (names[i])
+        if (!read_name_ok(names[i++]))
+            return (read_error(names[i - 1], ": not a valid identifier\n", 0));
+    joined = NULL;
+    status = read_line(&r, shell, &joined);
+    if (!r.line)
+        r.line = "";
+    if (status >= 0 && !read_assign(&r, names, shell))
+        status = -1;
+    free(joined);
+    if (status == -1 && errno == EINTR)
+        return (128 + SIGINT);
+    if (status == -1)
+        return (perror("minishell: read"), 1);
+    return (status == 0);
+}
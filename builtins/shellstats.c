@@ -0,0 +1,66 @@
+#include "../includes/minishell.h"
+#include <malloc.h>
+
+// um campo por linha em texto, ou um objeto JSON numa linha com --json
+static void stats_field(t_outbuf *ob, char *name, long value, int json,
+    int first)
+{
+    if (json)
+    {
+        if (!first)
+            outbuf_putc(ob, ',');
+        outbuf_putc(ob, '"');
+        outbuf_puts(ob, name);
+        outbuf_puts(ob, "\":");
+    }
+    else
+    {
+        outbuf_puts(ob, name);
+        outbuf_write(ob, "                ", 16 - ft_strlen(name));
+    }
+    outbuf_putnum(ob, value);
+    if (!json)
+        outbuf_putc(ob, '\n');
+}
+
+int builtin_shellstats(t_ast_node *cmd, t_shell *shell)
+{
+    static char         *stages[STAT_STAGES] = {"lex_ns", "parse_ns",
+        "expand_ns", "exec_ns"};
+    t_stats             *st;
+    t_outbuf            ob;
+    struct mallinfo2    mi;
+    int                 json;
+    int                 i;
+
+    json = 0;
+    if (cmd->args[1] && !ft_strcmp(cmd->args[1], "--json"))
+        json = 1;
+    else if (cmd->args[1])
+    {
+        ft_putstr_fd("minishell: shellstats: ", 2);
+        ft_putstr_fd(cmd->args[1], 2);
+        ft_putstr_fd(": invalid option\nshellstats: usage: shellstats"
+            " [--json]\n", 2);
+        return (2);
+    }
+    st = &shell->stats;
+    mi = mallinfo2();
+    outbuf_init(&ob, 1);
+    if (json)
+        outbuf_putc(&ob, '{');
+    stats_field(&ob, "lines", st->lines, json, 1);
+    stats_field(&ob, "tokens", st->tokens, json, 0);
+    stats_field(&ob, "ast_nodes", st->nodes, json, 0);
+    stats_field(&ob, "expanded", st->expanded, json, 0);
+    stats_field(&ob, "not_expanded", st->unexpanded, json, 0);
+    stats_field(&ob, "forks", st->forks, json, 0);
+    stats_field(&ob, "builtins", st->builtins, json, 0);
+    stats_field(&ob, "heap_bytes", mi.uordblks + mi.hblkhd, json, 0);
+    i = -1;
+    while (++i < STAT_STAGES)
+        stats_field(&ob, stages[i], st->ns[i], json, 0);
+    if (json)
+        outbuf_puts(&ob, "}\n");
+    return (builtin_write_error("shellstats", &ob));
+}
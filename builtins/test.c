@@ -0,0 +1,136 @@
+#include"../includes/minishell.h"
+
+int test_error(t_test *t, char *arg, char *msg)
+{
+    if (t->error)
+        return (0);
+    t->error = 1;
+    ft_putstr_fd("minishell: ", 2);
+    ft_putstr_fd(t->name, 2);
+    ft_putstr_fd(": ", 2);
+    if (arg)
+    {
+        ft_putstr_fd(arg, 2);
+        ft_putstr_fd(": ", 2);
+    }
+    ft_putstr_fd(msg, 2);
+    ft_putstr_fd("\n", 2);
+    return (0);
+}
+
+static int test_or(t_test *t);
+
+// primario: ( expr ), arg op arg, -op arg, ou uma string (verdade se nao vazia)
+static int test_primary(t_test *t)
+{
+    int     result;
+    char    **av;
+
+    av = t->av + t->pos;
+    if (t->pos >= t->ac)
+        return (test_error(t, NULL, "argument expected"));
+    if (!ft_strcmp(av[0], "(") && t->pos + 1 < t->ac)
+    {
+        t->pos++;
+        result = test_or(t);
+        if (t->pos >= t->ac || ft_strcmp(t->av[t->pos], ")"))
+            return (test_error(t, NULL, "`)' expected"));
+        t->pos++;
+        return (result);
+    }
+    if (t->pos + 2 < t->ac && is_test_binary(av[1]))
+        return (t->pos += 3, test_binary(t, av[0], av[1], av[2]));
+    if (is_test_unary(av[0]) && t->pos + 1 < t->ac)
+        return (t->pos += 2, test_unary(t, av[0], av[1]));
+    t->pos++;
+    return (av[0][0] != '\0');
+}
+
+static int test_not(t_test *t)
+{
+    if (t->pos < t->ac && !ft_strcmp(t->av[t->pos], "!"))
+    {
+        t->pos++;
+        return (!test_not(t));
+    }
+    return (test_primary(t));
+}
+
+static int test_and(t_test *t)
+{
+    int result;
+
+    result = test_not(t);
+    while (t->pos < t->ac && !ft_strcmp(t->av[t->pos], "-a"))
+    {
+        t->pos++;
+        result = test_not(t) && result;
+    }
+    return (result);
+}
+
+static int test_or(t_test *t)
+{
+    int result;
+
+    result = test_and(t);
+    while (t->pos < t->ac && !ft_strcmp(t->av[t->pos], "-o"))
+    {
+        t->pos++;
+        result = test_and(t) || result;
+    }
+    return (result);
+}
+
+// regras do POSIX pelo numero de argumentos (ate 4), depois a gramatica
+static int test_eval(t_test *t, int n)
+{
+    char    **av;
+
+    av = t->av + t->pos;
+    if (n == 0)
+        return (0);
+    if (n == 1)
+        return (t->pos++, av[0][0] != '\0');
+    if (n == 2 && !ft_strcmp(av[0], "!"))
+        return (t->pos++, !test_eval(t, 1));
+    if (n == 2 && !is_test_unary(av[0]))
+        return (test_error(t, av[0], "unary operator expected"));
+    if (n == 3 && is_test_binary(av[1]))
+        return (t->pos += 3, test_binary(t, av[0], av[1], av[2]));
+    if ((n == 3 || n == 4) && !ft_strcmp(av[0], "!"))
+        return (t->pos++, !test_eval(t, n - 1));
+    if ((n == 3 || n == 4) && !ft_strcmp(av[0], "(")
+        && !ft_strcmp(av[n - 1], ")"))
+    {
+        t->pos++;
+        n = test_eval(t, n - 2);
+        return (t->pos++, n);
+    }
+    return (test_or(t));
+}
+
+// test expr / [ expr ]: 0 verdadeiro, 1 falso, 2 erro
+int builtin_test(t_ast_node *cmd)
+{
+    t_test  t;
+    int     result;
+
+    t.name = cmd->args[0];
+    t.av = cmd->args + 1;
+    t.ac = args_count(t.av);
+    t.pos = 0;
+    t.error = 0;
+    if (!ft_strcmp(t.name, "["))
+    {
+        if (t.ac == 0 || ft_strcmp(t.av[t.ac - 1], "]"))
+            return (test_error(&t, NULL, "missing `]'"), 2);
+        t.ac--;
+    }
+    result = test_eval(&t, t.ac);
+    if (!t.error && t.pos < t.ac)
+        test_error(&t, t.av[t.pos], "too many arguments");
+    if (t.error)
+        return (2);
+    return (!result);
+}
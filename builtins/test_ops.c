@@ -0,0 +1,126 @@
+#include"../includes/minishell.h"
+#include <sys/stat.h>
+
+int is_test_unary(char *op)
+{
+    if (!op || op[0] != '-' || !op[1] || op[2])
+        return (0);
+    return (ft_strchr("efdsrwxLhpSbcnzt", op[1]) != NULL);
+}
+
+int is_test_binary(char *op)
+{
+    if (!op)
+        return (0);
+    return (!ft_strcmp(op, "=") || !ft_strcmp(op, "==")
+        || !ft_strcmp(op, "!=") || !ft_strcmp(op, "<")
+        || !ft_strcmp(op, ">") || !ft_strcmp(op, "-eq")
+        || !ft_strcmp(op, "-ne") || !ft_strcmp(op, "-lt")
+        || !ft_strcmp(op, "-le") || !ft_strcmp(op, "-gt")
+        || !ft_strcmp(op, "-ge"));
+}
+
+// inteiro com espacos e sinal opcionais; senao erro como no bash, que
+// tambem recusa o que nao cabe num long long
+static int test_number(t_test *t, char *str, long long *out)
+{
+    int i;
+    int sign;
+    int d;
+
+    i = 0;
+    while (str[i] == ' ' || str[i] == '\t')
+        i++;
+    sign = 1;
+    if (str[i] == '-' || str[i] == '+')
+        sign = 1 - 2 * (str[i++] == '-');
+    *out = 0;
+    if (!ft_isdigit(str[i]))
+        return (test_error(t, str, "integer expression expected"));
+    while (ft_isdigit(str[i]))
+    {
+        d = str[i++] - '0';
+        if ((sign > 0 && *out > (LLONG_MAX - d) / 10)
+            || (sign < 0 && *out < (LLONG_MIN + d) / 10))
+            return (test_error(t, str, "integer expression expected"));
+        *out = *out * 10 + sign * d;
+    }
+    while (str[i] == ' ' || str[i] == '\t')
+        i++;
+    if (str[i])
+        return (test_error(t, str, "integer expression expected"));
+    return (1);
+}
+
+// testes de ficheiro: um so stat (lstat para -L/-h), ou access para -rwx
+static int test_file(char op, char *path)
+{
+    struct stat st;
+
+    if (op == 'r')
+        return (access(path, R_OK) == 0);
+    if (op == 'w')
+        return (access(path, W_OK) == 0);
+    if (op == 'x')
+        return (access(path, X_OK) == 0);
+    if (op == 'L' || op == 'h')
+        return (lstat(path, &st) == 0 && S_ISLNK(st.st_mode));
+    if (stat(path, &st) == -1)
+        return (0);
+    if (op == 'f')
+        return (S_ISREG(st.st_mode));
+    if (op == 'd')
+        return (S_ISDIR(st.st_mode));
+    if (op == 's')
+        return (st.st_size > 0);
+    if (op == 'p')
+        return (S_ISFIFO(st.st_mode));
+    if (op == 'S')
+        return (S_ISSOCK(st.st_mode));
+    if (op == 'b')
+        return (S_ISBLK(st.st_mode));
+    if (op == 'c')
+        return (S_ISCHR(st.st_mode));
+    return (1);
+}
+
+int test_unary(t_test *t, char *op, char *arg)
+{
+    long long   fd;
+
+    if (op[1] == 'n')
+        return (arg[0] != '\0');
+    if (op[1] == 'z')
+        return (arg[0] == '\0');
+    if (op[1] == 't')
+        return (test_number(t, arg, &fd) && isatty(fd));
+    return (test_file(op[1], arg));
+}
+
+int test_binary(t_test *t, char *left, char *op, char *right)
+{
+    long long   l;
+    long long   r;
+
+    if (!ft_strcmp(op, "=") || !ft_strcmp(op, "=="))
+        return (ft_strcmp(left, right) == 0);
+    if (!ft_strcmp(op, "!="))
+        return (ft_strcmp(left, right) != 0);
+    if (!ft_strcmp(op, "<"))
+        return (ft_strcmp(left, right) < 0);
+    if (!ft_strcmp(op, ">"))
+        return (ft_strcmp(left, right) > 0);
+    if (!test_number(t, left, &l) || !test_number(t, right, &r))
+        return (0);
+    if (!ft_strcmp(op, "-eq"))
+        return (l == r);
+    if (!ft_strcmp(op, "-ne"))
+        return (l != r);
+    if (!ft_strcmp(op, "-lt"))
+        return (l < r);
+    if (!ft_strcmp(op, "-le"))
+        return (l <= r);
+    if (!ft_strcmp(op, "-gt"))
+        return (l > r);
+    return (l >= r);
+}
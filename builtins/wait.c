@@ -0,0 +1,114 @@
+#include"../includes/minishell.h"
+
+// espera ate todos os processos do job terminarem; -1 se Ctrl-C
+static int wait_job(t_shell *shell, t_job *job)
+{
+    while (waitset_running(&shell->children, job->slots, job->n) > 0)
+    {
+        if (waitset_wait_any(&shell->children, job->slots, job->n) == -1)
+            return (-1);
+    }
+    return (job_finish(shell, job));
+}
+
+// junta os slots de todos os jobs para esperar pelo primeiro que acabar
+static int *all_job_slots(t_shell *shell, int *count)
+{
+    t_job   *job;
+    int     *slots;
+    int     i;
+
+    *count = 0;
+    job = shell->jobs;
+    while (job)
+    {
+        *count += job->n;
+        job = job->next;
+    }
+    slots = malloc(sizeof(int) * (*count));
+    if (!slots)
+        return (NULL);
+    i = 0;
+    job = shell->jobs;
+    while (job)
+    {
+        ft_memcpy(slots + i, job->slots, sizeof(int) * job->n);
+        i += job->n;
+        job = job->next;
+    }
+    return (slots);
+}
+
+// wait -n: o primeiro job a terminar, 127 se nao houver jobs
+static int wait_next(t_shell *shell)
+{
+    t_job   *job;
+    int     *slots;
+    int     count;
+    int     ret;
+
+    while (shell->jobs)
+    {
+        job = shell->jobs;
+        while (job && waitset_running(&shell->children, job->slots, job->n))
+            job = job->next;
+        if (job)
+            return (job_finish(shell, job));
+        slots = all_job_slots(shell, &count);
+        if (!slots)
+            return (1);
+        ret = waitset_wait_any(&shell->children, slots, count);
+        free(slots);
+        if (ret == -1)
+            return (-1);
+    }
+    return (127);
+}
+
+// wait %N / wait pid: status do ultimo job, 127 se algum nao existir
+static int wait_operands(char **args, t_shell *shell)
+{
+    t_job   *job;
+    int     status;
+    int     i;
+
+    status = 0;
+    i = 1;
+    while (args[i] && status != -1)
+    {
+        job = job_find(shell, args[i]);
+        if (!job)
+        {
+            ft_putstr_fd("minishell: wait: ", 2);
+            ft_putstr_fd(args[i], 2);
+            ft_putstr_fd(": no such job\n", 2);
+            status = 127;
+        }
+        else
+            status = wait_job(shell, job);
+        i++;
+    }
+    return (status);
+}
+
+int builtin_wait(t_ast_node *cmd, t_shell *shell)
+{
+    int status;
+
+    setup_wait_signals();
+    if (cmd->args[1] && ft_strcmp(cmd->args[1], "-n") == 0)
+        status = wait_next(shell);
+    else if (cmd->args[1])
+        status = wait_operands(cmd->args, shell);
+    else
+    {
+        status = 0;
+        while (shell->jobs && status != -1)
+            status = wait_job(shell, shell->jobs);
+        if (status != -1)
+            status = 0;
+    }
+    if (status == -1)
+        return (128 + SIGINT);
+    return (status);
+}
@@ -0,0 +1,117 @@
+#define _GNU_SOURCE
+#include "includes/minishell.h"
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+
+/**
+ * copy_kernel - Copies with one of the in-kernel paths until EOF
+ * @in: Source descriptor
+ * @out: Target descriptor
+ * @how: COPY_RANGE, COPY_SENDFILE or COPY_SPLICE
+ *
+ * The data never reaches user space. All three calls move the file
+ * offsets themselves, so a fallback can carry on where they stopped.
+ * A Ctrl-C ends the copy, even one the kernel only cut short.
+ *
+ * Returns: 1 at EOF, 0 if the path is not supported for these
+ * descriptors (errno kept), -1 on a real error or EINTR
+ */
+static int	copy_kernel(int in, int out, int how)
+{
+	ssize_t	n;
+
+	n = 1;
+	while (n > 0)
+	{
+		if (how == COPY_RANGE)
+			n = copy_file_range(in, NULL, out, NULL, COPY_CHUNK, 0);
+		else if (how == COPY_SENDFILE)
+			n = sendfile(out, in, NULL, COPY_CHUNK);
+		else
+			n = splice(in, NULL, out, NULL, COPY_CHUNK, SPLICE_F_MOVE);
+		if (n > 0 && sigint_received())
+		{
+			errno = EINTR;
+			n = -1;
+		}
+	}
+	if (n == 0)
+		return (1);
+	if (errno == EINVAL || errno == ENOSYS || errno == EXDEV
+		|| errno == EOPNOTSUPP || errno == EBADF)
+		return (0);
+	return (-1);
+}
+
+/**
+ * copy_buffered - Copies through a user-space buffer until EOF
+ * @in: Source descriptor
+ * @out: Target descriptor
+ *
+ * The buffer is page aligned and large enough to amortize the system
+ * calls; it is static, so a copy never allocates. EINTR (Ctrl-C) ends
+ * the copy like an error.
+ *
+ * Returns: 1 at EOF, -1 on error
+ */
+static int	copy_buffered(int in, int out)
+{
+	static char	buf[COPY_BUFFER] __attribute__((aligned(4096)));
+	ssize_t		n;
+	ssize_t		done;
+	ssize_t		w;
+
+	n = 1;
+	while (n != 0)
+	{
+		n = read(in, buf, sizeof(buf));
+		if (n == -1)
+			return (-1);
+		done = 0;
+		while (done < n)
+		{
+			w = write(out, buf + done, n - done);
+			if (w == -1)
+				return (-1);
+			done += w;
+		}
+	}
+	return (1);
+}
+
+/**
+ * copy_fd - Copies everything readable from in to out
+ * @in: Source descriptor
+ * @out: Target descriptor
+ *
+ * Picks the cheapest path the descriptors allow: copy_file_range()
+ * between two regular files (which may share extents on reflink file
+ * systems), sendfile() from a regular file to anything else, splice()
+ * when either side is a pipe, and a read/write loop otherwise or when
+ * the kernel refuses a path (O_APPEND targets...). Regular files that
+ * claim a size of 0 (/proc, /sys) are read like pipes: the in-kernel
+ * copies would stop at the advertised size.
+ *
+ * Returns: 1 on success, 0 on error (errno set, EINTR after a Ctrl-C)
+ */
+int	copy_fd(int in, int out)
+{
+	struct stat	in_st;
+	struct stat	out_st;
+	int			ret;
+
+	if (fstat(in, &in_st) == -1 || fstat(out, &out_st) == -1)
+		return (0);
+	ret = 0;
+	if (S_ISREG(in_st.st_mode) && in_st.st_size == 0)
+		ret = copy_buffered(in, out);
+	if (ret == 0 && S_ISREG(in_st.st_mode) && S_ISREG(out_st.st_mode))
+		ret = copy_kernel(in, out, COPY_RANGE);
+	if (ret == 0 && S_ISREG(in_st.st_mode))
+		ret = copy_kernel(in, out, COPY_SENDFILE);
+	if (ret == 0 && (S_ISFIFO(in_st.st_mode) || S_ISFIFO(out_st.st_mode)))
+		ret = copy_kernel(in, out, COPY_SPLICE);
+	if (ret == 0)
+		ret = copy_buffered(in, out);
+	return (ret == 1);
+}
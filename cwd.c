@@ -0,0 +1,151 @@
+#include "includes/minishell.h"
+#include <sys/stat.h>
+
+/**
+ * cwd_canon - Builds a canonical absolute path, without touching disk
+ * @base: Absolute directory relative paths start from
+ * @path: Absolute or relative path
+ *
+ * "." components and repeated slashes are dropped and ".." removes the
+ * previous component, lexically: `cd` follows the path the user typed
+ * (symbolic links included), the way POSIX describes cd -L.
+ *
+ * Returns: Allocated canonical path, or NULL on allocation failure
+ */
+char	*cwd_canon(const char *base, const char *path)
+{
+	char	*out;
+	size_t	len;
+	size_t	n;
+
+	out = malloc(ft_strlen(base) + ft_strlen(path) + 3);
+	if (!out)
+		return (NULL);
+	len = 0;
+	if (path[0] != '/' && ft_strcmp(base, "/"))
+	{
+		len = ft_strlen(base);
+		ft_memcpy(out, base, len);
+	}
+	while (*path)
+	{
+		while (*path == '/')
+			path++;
+		n = 0;
+		while (path[n] && path[n] != '/')
+			n++;
+		if (n == 2 && path[0] == '.' && path[1] == '.')
+			while (len > 0 && out[--len] != '/')
+				;
+		else if (n > 0 && !(n == 1 && path[0] == '.'))
+		{
+			out[len++] = '/';
+			ft_memcpy(out + len, path, n);
+			len += n;
+		}
+		path += n;
+	}
+	if (len == 0)
+		out[len++] = '/';
+	out[len] = '\0';
+	return (out);
+}
+
+/**
+ * cwd_stat - Records which directory the cached path names
+ * @shell: Shell context, shell->cwd.path set
+ */
+static void	cwd_stat(t_shell *shell)
+{
+	struct stat	st;
+
+	shell->cwd.dev = 0;
+	shell->cwd.ino = 0;
+	if (stat(shell->cwd.path, &st) == 0)
+	{
+		shell->cwd.dev = st.st_dev;
+		shell->cwd.ino = st.st_ino;
+	}
+}
+
+/**
+ * cwd_set - Makes path the logical working directory
+ * @shell: Shell context
+ * @path: Allocated canonical path (owned by the shell from now on)
+ *
+ * The previous directory goes to OLDPWD and the new one to PWD, so
+ * $PWD expands from the environment without any system call.
+ */
+void	cwd_set(t_shell *shell, char *path)
+{
+	if (shell->cwd.path)
+		env_set(shell, "OLDPWD", shell->cwd.path,
+			ft_strlen(shell->cwd.path));
+	free(shell->cwd.path);
+	shell->cwd.path = path;
+	env_set(shell, "PWD", path, ft_strlen(path));
+	cwd_stat(shell);
+}
+
+/**
+ * cwd_init - Sets up the logical working directory at startup
+ * @shell: Shell context, environment indexed
+ *
+ * An inherited $PWD is kept when it is absolute, canonical and names
+ * the current directory, as POSIX shells do; getcwd() is the fallback.
+ * The result is exported without touching OLDPWD.
+ */
+void	cwd_init(t_shell *shell)
+{
+	struct stat	dot;
+	char		*pwd;
+	char		*path;
+
+	path = NULL;
+	pwd = get_env_value("PWD", shell);
+	if (pwd && pwd[0] == '/' && stat(".", &dot) == 0)
+	{
+		path = cwd_canon("/", pwd);
+		shell->cwd.path = path;
+		cwd_stat(shell);
+		if (!path || ft_strcmp(path, pwd) || shell->cwd.dev != dot.st_dev
+			|| shell->cwd.ino != dot.st_ino)
+		{
+			free(path);
+			path = NULL;
+		}
+	}
+	if (!path)
+		path = getcwd(NULL, 0);
+	shell->cwd.path = NULL;
+	if (path)
+		cwd_set(shell, path);
+}
+
+/**
+ * cwd_get - Returns the logical working directory, revalidated
+ * @shell: Shell context
+ *
+ * A single stat() checks that the cached path still names the directory
+ * cd went to (it may have been renamed or replaced since); only then is
+ * getcwd() called to learn the new path.
+ *
+ * Returns: Cached path, or NULL if the directory cannot be found
+ */
+char	*cwd_get(t_shell *shell)
+{
+	struct stat	st;
+	char		*path;
+
+	if (shell->cwd.path && stat(shell->cwd.path, &st) == 0
+		&& st.st_dev == shell->cwd.dev && st.st_ino == shell->cwd.ino)
+		return (shell->cwd.path);
+	path = getcwd(NULL, 0);
+	if (!path)
+		return (NULL);
+	free(shell->cwd.path);
+	shell->cwd.path = path;
+	env_set(shell, "PWD", path, ft_strlen(path));
+	cwd_stat(shell);
+	return (path);
+}
@@ -0,0 +1,131 @@
+#include "includes/minishell.h"
+
+/**
+ * env_hash - Hashes a variable name (FNV-1a)
+ * @name: Name (need not be NUL-terminated)
+ * @len: Length of the name
+ *
+ * Returns: Hash of the name
+ */
+static unsigned int	env_hash(const char *name, size_t len)
+{
+	unsigned int	h;
+
+	h = 2166136261u;
+	while (len-- > 0)
+		h = (h ^ (unsigned char)*name++) * 16777619u;
+	return (h);
+}
+
+/**
+ * env_name_len - Length of the name part of an entry
+ * @entry: "NAME=value" string
+ *
+ * Returns: Number of bytes before the '='
+ */
+size_t	env_name_len(const char *entry)
+{
+	size_t	len;
+
+	len = 0;
+	while (entry[len] && entry[len] != '=')
+		len++;
+	return (len);
+}
+
+/**
+ * env_bucket - Finds the hash bucket of a name
+ * @ix: Environment index (table allocated)
+ * @envp: Environment the index points into
+ * @name: Name to look for (need not be NUL-terminated)
+ * @len: Length of the name
+ *
+ * Linear probing: the table is kept at most half full, so a lookup
+ * touches one or two buckets on average.
+ *
+ * Returns: Bucket holding the name, or the empty bucket it would go to
+ */
+int	env_bucket(t_env_index *ix, char **envp, const char *name, size_t len)
+{
+	int		b;
+	char	*entry;
+
+	b = env_hash(name, len) & (ix->size - 1);
+	while (ix->table[b] != -1)
+	{
+		entry = envp[ix->table[b]];
+		if (!ft_strncmp(entry, name, len) && entry[len] == '=')
+			return (b);
+		b = (b + 1) & (ix->size - 1);
+	}
+	return (b);
+}
+
+/**
+ * env_table_build - (Re)builds the hash table for the current capacity
+ * @ix: Environment index
+ * @envp: Environment to index
+ *
+ * Called when envp grows, so rehashing is amortized over the appends.
+ *
+ * Returns: 1 on success, 0 on allocation failure
+ */
+int	env_table_build(t_env_index *ix, char **envp)
+{
+	int	*table;
+	int	size;
+	int	i;
+
+	size = 16;
+	while (size < ix->cap * 2)
+		size *= 2;
+	table = malloc(sizeof(int) * size);
+	if (!table)
+		return (0);
+	free(ix->table);
+	ix->table = table;
+	ix->size = size;
+	i = 0;
+	while (i < size)
+		table[i++] = -1;
+	i = 0;
+	while (i < ix->len)
+	{
+		table[env_bucket(ix, envp, envp[i],
+				env_name_len(envp[i]))] = i;
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * env_table_remove - Empties a bucket, keeping the probe chains intact
+ * @ix: Environment index
+ * @envp: Environment the index points into
+ * @b: Bucket to empty
+ *
+ * Backward-shift deletion: later entries of the chain that could live in
+ * the freed bucket move up, so no tombstones are needed.
+ */
+void	env_table_remove(t_env_index *ix, char **envp, int b)
+{
+	int	mask;
+	int	j;
+	int	home;
+
+	mask = ix->size - 1;
+	ix->table[b] = -1;
+	j = (b + 1) & mask;
+	while (ix->table[j] != -1)
+	{
+		home = env_hash(envp[ix->table[j]],
+				env_name_len(envp[ix->table[j]])) & mask;
+		if (((j - home) & mask) >= ((j - b) & mask))
+		{
+			ix->table[b] = ix->table[j];
+			ix->table[j] = -1;
+			b = j;
+		}
+		j = (j + 1) & mask;
+	}
+}
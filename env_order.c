@@ -0,0 +1,104 @@
+#include "includes/minishell.h"
+
+/**
+ * env_namecmp - Compares a name with the name of an entry
+ * @name: Name (need not be NUL-terminated)
+ * @len: Length of the name
+ * @entry: "NAME=value" string
+ *
+ * Returns: <0, 0 or >0 as name sorts before, with or after the entry
+ */
+static int	env_namecmp(const char *name, size_t len, const char *entry)
+{
+	size_t	i;
+	int		a;
+	int		b;
+
+	i = 0;
+	while (i < len && entry[i] && entry[i] != '=' && name[i] == entry[i])
+		i++;
+	a = 0;
+	if (i < len)
+		a = (unsigned char)name[i];
+	b = 0;
+	if (entry[i] && entry[i] != '=')
+		b = (unsigned char)entry[i];
+	return (a - b);
+}
+
+/**
+ * env_order_find - Binary search of a name in the sorted index
+ * @ix: Environment index
+ * @envp: Environment the index points into
+ * @name: Name to look for
+ * @len: Length of the name
+ *
+ * Returns: Position of the name, or the position it would be inserted at
+ */
+int	env_order_find(t_env_index *ix, char **envp, const char *name,
+		size_t len)
+{
+	int	lo;
+	int	hi;
+	int	mid;
+
+	lo = 0;
+	hi = ix->len;
+	while (lo < hi)
+	{
+		mid = (lo + hi) / 2;
+		if (env_namecmp(name, len, envp[ix->order[mid]]) > 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return (lo);
+}
+
+/**
+ * env_order_insert - Adds a new slot to the sorted index
+ * @ix: Environment index (ix->len not counting the new slot yet)
+ * @envp: Environment, envp[slot] already set
+ * @slot: Slot of the new variable
+ *
+ * One binary search and a memmove() of the int positions after it, so
+ * `export` never has to sort the whole environment.
+ */
+void	env_order_insert(t_env_index *ix, char **envp, int slot)
+{
+	int	pos;
+
+	pos = env_order_find(ix, envp, envp[slot], env_name_len(envp[slot]));
+	ft_memmove(ix->order + pos + 1, ix->order + pos,
+		sizeof(int) * (ix->len - pos));
+	ix->order[pos] = slot;
+}
+
+/**
+ * env_order_remove - Removes a variable from the sorted index
+ * @ix: Environment index (ix->len still counting the variable)
+ * @envp: Environment, the variable still in it
+ * @slot: Slot of the variable
+ */
+void	env_order_remove(t_env_index *ix, char **envp, int slot)
+{
+	int	pos;
+
+	pos = env_order_find(ix, envp, envp[slot], env_name_len(envp[slot]));
+	ft_memmove(ix->order + pos, ix->order + pos + 1,
+		sizeof(int) * (ix->len - pos - 1));
+}
+
+/**
+ * env_order_move - Records that a variable moved to another slot
+ * @ix: Environment index
+ * @envp: Environment, envp[to] holding the moved variable
+ * @to: New slot of the variable
+ */
+void	env_order_move(t_env_index *ix, char **envp, int to)
+{
+	int	pos;
+
+	pos = env_order_find(ix, envp, envp[to], env_name_len(envp[to]));
+	ix->order[pos] = to;
+}
@@ -0,0 +1,198 @@
+#include "includes/minishell.h"
+
+/**
+ * env_init - Indexes the environment copied by init_envp()
+ * @shell: Shell context, shell->envp set
+ *
+ * Returns: 1 on success, 0 on allocation failure
+ */
+int	env_init(t_shell *shell)
+{
+	t_env_index	*ix;
+	int			n;
+
+	ix = &shell->env;
+	if (!shell->envp)
+		shell->envp = ft_calloc(1, sizeof(char *));
+	if (!shell->envp)
+		return (0);
+	n = args_count(shell->envp);
+	ix->len = 0;
+	ix->cap = n;
+	ix->order = malloc(sizeof(int) * (n + 1));
+	if (!ix->order || !env_table_build(ix, shell->envp))
+		return (0);
+	while (ix->len < n)
+	{
+		ix->table[env_bucket(ix, shell->envp, shell->envp[ix->len],
+				env_name_len(shell->envp[ix->len]))] = ix->len;
+		env_order_insert(ix, shell->envp, ix->len);
+		ix->len++;
+	}
+	return (1);
+}
+
+/**
+ * env_find - Looks up a variable in the environment
+ * @shell: Shell context
+ * @name: Name to look for (need not be NUL-terminated)
+ * @len: Length of the name
+ *
+ * Shells whose envp was not indexed (tests building a t_shell by hand)
+ * fall back to a linear scan.
+ *
+ * Returns: Slot of the entry in shell->envp, or -1 if it is not set
+ */
+int	env_find(t_shell *shell, const char *name, size_t len)
+{
+	int	i;
+
+	if (!shell->envp)
+		return (-1);
+	if (shell->env.table)
+		return (shell->env.table[env_bucket(&shell->env, shell->envp,
+					name, len)]);
+	i = 0;
+	while (shell->envp[i])
+	{
+		if (!ft_strncmp(shell->envp[i], name, len)
+			&& shell->envp[i][len] == '=')
+			return (i);
+		i++;
+	}
+	return (-1);
+}
+
+/**
+ * env_grow - Doubles the room of envp and of the index
+ * @shell: Shell context
+ *
+ * Returns: 1 on success, 0 on allocation failure
+ */
+static int	env_grow(t_shell *shell)
+{
+	t_env_index	*ix;
+	char		**envp;
+	int			*order;
+	int			cap;
+
+	ix = &shell->env;
+	cap = ix->cap * 2 + 16;
+	envp = malloc(sizeof(char *) * (cap + 1));
+	order = malloc(sizeof(int) * (cap + 1));
+	if (!envp || !order)
+		return (free(envp), free(order), 0);
+	ft_memcpy(envp, shell->envp, sizeof(char *) * (ix->len + 1));
+	ft_memcpy(order, ix->order, sizeof(int) * ix->len);
+	free(shell->envp);
+	free(ix->order);
+	shell->envp = envp;
+	ix->order = order;
+	ix->cap = cap;
+	return (env_table_build(ix, envp));
+}
+
+/**
+ * env_put - Sets a variable from a complete entry
+ * @shell: Shell context (indexed by env_init())
+ * @entry: Allocated "NAME=value" string, owned by the environment on
+ * success
+ *
+ * An existing variable keeps its slot; a new one is appended, so both
+ * cost O(1) amortized plus the insertion in the sorted index.
+ *
+ * Returns: 1 on success, 0 on allocation failure
+ */
+int	env_put(t_shell *shell, char *entry)
+{
+	t_env_index	*ix;
+	size_t		len;
+	int			b;
+
+	ix = &shell->env;
+	len = env_name_len(entry);
+	b = env_bucket(ix, shell->envp, entry, len);
+	if (ix->table[b] != -1)
+	{
+		free(shell->envp[ix->table[b]]);
+		shell->envp[ix->table[b]] = entry;
+		return (1);
+	}
+	if (ix->len == ix->cap)
+	{
+		if (!env_grow(shell))
+			return (0);
+		b = env_bucket(ix, shell->envp, entry, len);
+	}
+	shell->envp[ix->len] = entry;
+	shell->envp[ix->len + 1] = NULL;
+	ix->table[b] = ix->len;
+	env_order_insert(ix, shell->envp, ix->len);
+	ix->len++;
+	return (1);
+}
+
+/**
+ * env_set - Sets a variable from a name and a slice of memory
+ * @shell: Shell context
+ * @name: Variable name (NUL-terminated)
+ * @value: Start of the value (need not be NUL-terminated)
+ * @len: Length of the value
+ *
+ * The "NAME=value" entry is built in one allocation straight from the
+ * slice, so callers such as `read` can hand out fields of a line
+ * without copying them first.
+ *
+ * Returns: 1 on success, 0 on allocation failure
+ */
+int	env_set(t_shell *shell, char *name, char *value, size_t len)
+{
+	char	*entry;
+	size_t	name_len;
+
+	name_len = ft_strlen(name);
+	entry = malloc(name_len + len + 2);
+	if (!entry)
+		return (0);
+	ft_memcpy(entry, name, name_len);
+	entry[name_len] = '=';
+	ft_memcpy(entry + name_len + 1, value, len);
+	entry[name_len + 1 + len] = '\0';
+	if (!env_put(shell, entry))
+		return (free(entry), 0);
+	return (1);
+}
+
+/**
+ * env_unset - Removes a variable
+ * @shell: Shell context (indexed by env_init())
+ * @name: Variable name (NUL-terminated)
+ *
+ * The last variable moves into the freed slot instead of shifting the
+ * tail: envp order does not matter, `export` lists through the sorted
+ * index.
+ */
+void	env_unset(t_shell *shell, char *name)
+{
+	t_env_index	*ix;
+	int			b;
+	int			slot;
+
+	ix = &shell->env;
+	b = env_bucket(ix, shell->envp, name, ft_strlen(name));
+	slot = ix->table[b];
+	if (slot == -1)
+		return ;
+	env_table_remove(ix, shell->envp, b);
+	env_order_remove(ix, shell->envp, slot);
+	free(shell->envp[slot]);
+	ix->len--;
+	if (slot != ix->len)
+	{
+		shell->envp[slot] = shell->envp[ix->len];
+		ix->table[env_bucket(ix, shell->envp, shell->envp[slot],
+				env_name_len(shell->envp[slot]))] = slot;
+		env_order_move(ix, shell->envp, slot);
+	}
+	shell->envp[ix->len] = NULL;
+}
@@ -0,0 +1,107 @@
+#include "includes/minishell.h"
+
+/**
+ * reset_child_signals - Restores default signal handling in a child
+ *
+ * The shell ignores SIGQUIT, and an ignored disposition survives
+ * execve(), so children have to put both signals back themselves.
+ */
+void	reset_child_signals(void)
+{
+	signal(SIGINT, SIG_DFL);
+	signal(SIGQUIT, SIG_DFL);
+}
+
+/**
+ * exec_error - Reports a failed execve() and leaves the child
+ * @name: Command name as typed
+ * @err: errno of the failure
+ *
+ * Exits with 127 when the command does not exist, 126 otherwise.
+ */
+static void	exec_error(char *name, int err)
+{
+	ft_putstr_fd("minishell: ", 2);
+	ft_putstr_fd(name, 2);
+	if (err == ENOENT && !ft_strchr(name, '/'))
+		ft_putstr_fd(": command not found\n", 2);
+	else
+	{
+		ft_putstr_fd(": ", 2);
+		ft_putstr_fd(strerror(err), 2);
+		ft_putstr_fd("\n", 2);
+	}
+	if (err == ENOENT)
+		_exit(127);
+	_exit(126);
+}
+
+/**
+ * try_path_entry - Tries to run a command from one PATH directory
+ * @dir: Start of the directory in PATH
+ * @len: Length of the directory (0 means the current directory)
+ * @args: Command arguments
+ * @shell: Shell context
+ *
+ * The candidate is built on the stack and handed straight to execve(),
+ * which does the existence check itself.
+ *
+ * Returns: errno of the failed attempt (only returns on failure)
+ */
+static int	try_path_entry(char *dir, size_t len, char **args, t_shell *shell)
+{
+	char	path[PATH_MAX];
+	size_t	name_len;
+
+	name_len = ft_strlen(args[0]);
+	if (len == 0)
+	{
+		dir = ".";
+		len = 1;
+	}
+	if (len + name_len + 2 > sizeof(path))
+		return (ENAMETOOLONG);
+	ft_memcpy(path, dir, len);
+	path[len] = '/';
+	ft_memcpy(path + len + 1, args[0], name_len + 1);
+	execve(path, args, shell->envp);
+	return (errno);
+}
+
+/**
+ * exec_command - Replaces the current process with a command
+ * @args: Command arguments (args[0] is the command name)
+ * @shell: Shell context (envp and PATH)
+ *
+ * Names containing '/' are run as-is, others are searched in PATH.
+ * A permission error is remembered while the search continues, the
+ * same way execvp() behaves. Never returns.
+ */
+void	exec_command(char **args, t_shell *shell)
+{
+	char	*path;
+	char	*end;
+	int		err;
+	int		found;
+
+	if (ft_strchr(args[0], '/') || !get_env_value("PATH", shell))
+	{
+		execve(args[0], args, shell->envp);
+		exec_error(args[0], errno);
+	}
+	path = get_env_value("PATH", shell);
+	found = ENOENT;
+	while (args[0][0])
+	{
+		end = ft_strchr(path, ':');
+		if (!end)
+			end = path + ft_strlen(path);
+		err = try_path_entry(path, end - path, args, shell);
+		if (err != ENOENT && err != ENOTDIR)
+			found = err;
+		if (!*end)
+			break ;
+		path = end + 1;
+	}
+	exec_error(args[0], found);
+}
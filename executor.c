@@ -0,0 +1,113 @@
+#include "includes/minishell.h"
+
+/**
+ * spawn_wait - Tracks a foreground child and waits for it
+ * @shell: Shell context (a slot must have been reserved)
+ * @pid: Child returned by fork()
+ *
+ * Returns: Exit code of the child, or 128 + signal if it was killed
+ */
+int	spawn_wait(t_shell *shell, pid_t pid)
+{
+	int	slot;
+
+	slot = waitset_add(&shell->children, pid);
+	shell->stats.forks++;
+	waitset_wait(&shell->children, &slot, 1, -1);
+	return (set_pipestatus(shell, &slot, 1));
+}
+
+/**
+ * run_builtin - Runs a builtin inside the shell process
+ * @cmd: Command node
+ * @shell: Shell context
+ *
+ * The builtin sees its redirections on stdin/stdout; the shell's own
+ * streams are restored afterwards. Ctrl-C interrupts whatever system
+ * call the builtin is blocked in (see setup_wait_signals()).
+ *
+ * Returns: Exit status of the builtin
+ */
+static int	run_builtin(t_ast_node *cmd, t_shell *shell)
+{
+	t_redir_plan	plan;
+	int				status;
+
+	if (!redirect_open(cmd->redirects, &plan))
+		return (1);
+	if (!redirect_save(&plan))
+	{
+		redirect_close(&plan);
+		return (1);
+	}
+	setup_wait_signals();
+	status = exec_builtin(cmd, shell);
+	redirect_restore(&plan);
+	redirect_close(&plan);
+	return (status);
+}
+
+/**
+ * execute_command - Executes a simple command
+ * @cmd: NODE_COMMAND node (already expanded)
+ * @shell: Shell context
+ *
+ * Redirections are opened in the parent before forking: a command
+ * whose target cannot be opened never costs a process. A command
+ * without arguments only performs its redirections.
+ *
+ * Returns: Exit status of the command
+ */
+int	execute_command(t_ast_node *cmd, t_shell *shell)
+{
+	t_redir_plan	plan;
+	pid_t			pid;
+
+	if (cmd->args && cmd->args[0] && is_builtin(cmd->args[0]))
+		return (record_status(shell, run_builtin(cmd, shell)));
+	if (!redirect_open(cmd->redirects, &plan))
+		return (record_status(shell, 1));
+	if (!cmd->args || !cmd->args[0])
+	{
+		redirect_close(&plan);
+		return (record_status(shell, 0));
+	}
+	pid = -1;
+	setup_exec_signals();
+	if (waitset_reserve(&shell->children, 1))
+		pid = control_fork();
+	if (pid == -1)
+	{
+		redirect_close(&plan);
+		return (record_status(shell, 1));
+	}
+	if (pid == 0)
+	{
+		reset_child_signals();
+		if (!redirect_child(&plan))
+			_exit(1);
+		exec_command(cmd->args, shell);
+	}
+	redirect_close(&plan);
+	return (spawn_wait(shell, pid));
+}
+
+/**
+ * execute_ast - Executes an expanded AST
+ * @ast: Root of the AST
+ * @shell: Shell context
+ *
+ * Returns: Exit status of the executed command line
+ */
+int	execute_ast(t_ast_node *ast, t_shell *shell)
+{
+	if (!ast)
+		return (0);
+	if (is_list_node(ast->type))
+		return (execute_list(ast, shell));
+	if (ast->type == NODE_PIPE)
+		return (execute_pipeline(ast, shell));
+	if (ast->type == NODE_TIME)
+		return (execute_time(ast, shell));
+	return (execute_command(ast, shell));
+}
@@ -17,6 +17,14 @@ static char	*get_expanded_value(char *var_name, int name_len, t_shell *shell)
 		return (NULL);
 	if (name_len == 1 && var_name[0] == '?')
 		return (ft_itoa(shell->exit_status));
+	if (name_len == 1 && var_name[0] == '!')
+	{
+		if (!shell->last_bg)
+			return (ft_strdup(""));
+		return (ft_itoa(shell->last_bg));
+	}
+	if (name_len == 10 && ft_strncmp(var_name, "PIPESTATUS", 10) == 0)
+		return (pipestatus_string(shell));
 	var_name_dup = ft_substr(var_name, 0, name_len);
 	if (!var_name_dup)
 		return (NULL);
@@ -115,6 +123,10 @@ char	*expand_string(char *str, int quoted, t_shell *shell)
  * @ast: Root of AST tree
  * @shell: Shell context
  *
+ * Members of a list (&&, ||, ;, &) are left alone: execute_list()
+ * expands each one right before it runs, so that $? and $! see the
+ * members before it.
+ *
  * Returns: 1 on success, 0 on error
  */
 int	expand_ast(t_ast_node *ast, t_shell *shell)
@@ -137,7 +149,10 @@ int	expand_ast(t_ast_node *ast, t_shell *shell)
 					return (0);
 				free(ast->args[i]);
 				ast->args[i] = expanded;
+				shell->stats.expanded++;
 			}
+			else
+				shell->stats.unexpanded++;
 			i++;
 		}
 		redir = ast->redirects;
@@ -150,10 +165,15 @@ int	expand_ast(t_ast_node *ast, t_shell *shell)
 					return (0);
 				free(redir->file);
 				redir->file = expanded;
+				shell->stats.expanded++;
 			}
+			else
+				shell->stats.unexpanded++;
 			redir = redir->next;
 		}
 	}
+	else if (ast->type == NODE_TIME)
+		return (!ast->left || expand_ast(ast->left, shell));
 	else if (ast->type == NODE_PIPE)
 	{
 		if (!expand_ast(ast->left, shell) || !expand_ast(ast->right, shell))
@@ -42,7 +42,7 @@ char	*ft_charjoin(char *s, char c)
  * @name: Variable name (without $)
  * @shell: Shell context with envp
  * 
- * Searches shell->envp for "NAME=value" format.
+ * Looks the name up through the environment index (env_find()).
  * 
  * Returns: Pointer to value (in envp), or NULL if not found
  */
@@ -50,21 +50,14 @@ char	*get_env_value(char *name, t_shell *shell)
 {
 	int		i;
 	int		len;
-	char	*env_entry;
 
 	if (!name || !shell || !shell->envp)
 		return (NULL);
 	len = ft_strlen(name);
-	i = 0;
-	while (shell->envp[i])
-	{
-		env_entry = shell->envp[i];
-		if (ft_strncmp(env_entry, name, len) == 0 
-			&& env_entry[len] == '=')
-			return (env_entry + len + 1);
-		i++;
-	}
-	return (NULL);
+	i = env_find(shell, name, len);
+	if (i == -1)
+		return (NULL);
+	return (shell->envp[i] + len + 1);
 }
 
 /**
@@ -76,7 +69,7 @@ char	*get_env_value(char *name, t_shell *shell)
  * - Must start with letter or underscore
  * - Can contain letters, digits, underscores
  * - Case-sensitive
- * - Special: $? is valid
+ * - Special: $? and $! are valid
  * 
  * Examples:
  *   "$HOME"  → name="HOME", len=4
@@ -92,7 +85,7 @@ char	*get_var_name(char *str, int *len)
 
 	if (!str || str[0] != '$')
 		return (NULL);
-	if (str[1] == '?')
+	if (str[1] == '?' || str[1] == '!')
 	{
 		*len = 1;
 		return (str + 1);
@@ -4,6 +4,26 @@ void	free_shell(t_shell *shell)
 {
 	if (shell->line)
 		free(shell->line);
+	shell->line = NULL;
+}
+
+/**
+ * env_free - Frees the environment and its index
+ * @shell: Shell context
+ */
+void	env_free(t_shell *shell)
+{
+	int	i;
+
+	i = 0;
+	while (shell->envp && shell->envp[i])
+		free(shell->envp[i++]);
+	free(shell->envp);
+	free(shell->env.table);
+	free(shell->env.order);
+	shell->envp = NULL;
+	shell->env.table = NULL;
+	shell->env.order = NULL;
 }
 
 void	free_array(char **envp)
@@ -16,7 +36,7 @@ void	free_array(char **envp)
 
 	while (NULL != envp[i])
 		i++;
-	while (i < j)
-		free(envp[i++]);
+	while (j < i)
+		free(envp[j++]);
 	free(envp);
 }
@@ -0,0 +1,159 @@
+#include "includes/minishell.h"
+
+/**
+ * heredoc_line - Feeds one body line to the sink
+ * @sink: Sink receiving the body
+ * @line: Line read from the terminal (without newline)
+ * @redir: Heredoc redirection (quoted delimiters disable expansion)
+ * @shell: Shell context
+ *
+ * Unquoted heredocs are expanded line by line, so the expander only ever
+ * sees one chunk of the body at a time.
+ *
+ * Returns: 1 on success, 0 on failure
+ */
+static int	heredoc_line(t_hdoc_sink *sink, char *line, t_redir_node *redir,
+		t_shell *shell)
+{
+	char	*expanded;
+	int		ret;
+
+	if (redir->quoted == 0 && ft_strchr(line, '$'))
+	{
+		expanded = expand_string(line, 0, shell);
+		if (!expanded)
+			return (0);
+		ret = sink_write(sink, expanded, ft_strlen(expanded));
+		free(expanded);
+	}
+	else
+		ret = sink_write(sink, line, ft_strlen(line));
+	return (ret && sink_write(sink, "\n", 1));
+}
+
+/**
+ * read_heredoc - Reads a heredoc body until its delimiter
+ * @sink: Sink receiving the body
+ * @redir: Heredoc redirection (file holds the delimiter)
+ * @shell: Shell context
+ *
+ * Returns: 1 on success, 0 on failure
+ */
+static int	read_heredoc(t_hdoc_sink *sink, t_redir_node *redir, t_shell *shell)
+{
+	char	*line;
+	int		ret;
+
+	while (1)
+	{
+		line = readline("> ");
+		if (!line)
+		{
+			ft_putstr_fd("minishell: warning: here-document delimited by "
+				"end-of-file (wanted `", 2);
+			ft_putstr_fd(redir->file, 2);
+			ft_putstr_fd("')\n", 2);
+			return (1);
+		}
+		if (ft_strcmp(line, redir->file) == 0)
+		{
+			free(line);
+			return (1);
+		}
+		ret = heredoc_line(sink, line, redir, shell);
+		free(line);
+		if (!ret)
+			return (0);
+	}
+}
+
+/**
+ * read_herestring - Builds a herestring body
+ * @sink: Sink receiving the body
+ * @redir: Herestring redirection (file holds the word)
+ * @shell: Shell context
+ *
+ * The body is the expanded word followed by a newline.
+ *
+ * Returns: 1 on success, 0 on failure
+ */
+static int	read_herestring(t_hdoc_sink *sink, t_redir_node *redir,
+		t_shell *shell)
+{
+	char	*word;
+	int		ret;
+
+	word = expand_string(redir->file, redir->quoted, shell);
+	if (!word)
+		return (0);
+	ret = sink_write(sink, word, ft_strlen(word));
+	free(word);
+	return (ret && sink_write(sink, "\n", 1));
+}
+
+/**
+ * collect_redirects - Collects the bodies of one command's redirections
+ * @redir: First redirection of the command
+ * @shell: Shell context
+ *
+ * Returns: 1 on success, 0 on failure
+ */
+static int	collect_redirects(t_redir_node *redir, t_shell *shell)
+{
+	t_hdoc_sink	sink;
+	int			ret;
+
+	while (redir)
+	{
+		if (redir->type == NODE_HEREDOC || redir->type == NODE_HERESTRING)
+		{
+			if (!sink_open(&sink))
+				return (0);
+			if (redir->type == NODE_HEREDOC)
+				ret = read_heredoc(&sink, redir, shell);
+			else
+				ret = read_herestring(&sink, redir, shell);
+			if (!ret)
+			{
+				sink_abort(&sink);
+				return (0);
+			}
+			redir->fd = sink_finish(&sink);
+			if (redir->fd == -1)
+				return (0);
+		}
+		redir = redir->next;
+	}
+	return (1);
+}
+
+/**
+ * collect_heredocs - Reads every heredoc and herestring in an AST
+ * @ast: Root of the AST
+ * @shell: Shell context
+ *
+ * Walks the tree left to right so bodies are read in the order they
+ * appear on the line, and all of them are read before any stage of the
+ * pipeline is launched. Each body ends up in redir->fd, ready to be
+ * dup'd onto stdin; ast_free() closes it.
+ *
+ * Must run before expand_ast(), which would expand the delimiters.
+ *
+ * Returns: 1 on success, 0 on failure
+ */
+int	collect_heredocs(t_ast_node *ast, t_shell *shell)
+{
+	if (!ast)
+		return (1);
+	if (ast->type == NODE_COMMAND)
+	{
+		if (!collect_redirects(ast->redirects, shell))
+		{
+			perror("minishell: heredoc");
+			return (0);
+		}
+		return (1);
+	}
+	return (collect_heredocs(ast->left, shell)
+		&& collect_heredocs(ast->right, shell));
+}
@@ -0,0 +1,166 @@
+#define _GNU_SOURCE
+#include "includes/minishell.h"
+#include <sys/mman.h>
+
+/**
+ * sink_open - Prepares a sink for a new heredoc body
+ * @sink: Sink to initialize
+ *
+ * Bodies start out in a pipe: as long as they fit its capacity the
+ * reader gets them without any file ever being created.
+ *
+ * Returns: 1 on success, 0 on failure
+ */
+int	sink_open(t_hdoc_sink *sink)
+{
+	int	cap;
+
+	sink->mem_fd = -1;
+	sink->written = 0;
+	sink->len = 0;
+	if (pipe2(sink->pipe_fd, O_CLOEXEC) == -1)
+		return (0);
+	cap = fcntl(sink->pipe_fd[1], F_GETPIPE_SZ);
+	if (cap <= 0)
+		cap = HEREDOC_CHUNK;
+	sink->pipe_cap = cap;
+	return (1);
+}
+
+/**
+ * sink_spill - Moves the body from the pipe into a memfd
+ * @sink: Sink whose body no longer fits the pipe
+ *
+ * The bytes already in the pipe are spliced into the memfd inside the
+ * kernel, then the pipe is closed.
+ *
+ * Returns: 1 on success, 0 on failure
+ */
+static int	sink_spill(t_hdoc_sink *sink)
+{
+	ssize_t	moved;
+	size_t	left;
+
+	sink->mem_fd = memfd_create("minishell-heredoc", MFD_CLOEXEC);
+	if (sink->mem_fd == -1)
+		return (0);
+	left = sink->written;
+	while (left > 0)
+	{
+		moved = splice(sink->pipe_fd[0], NULL, sink->mem_fd, NULL, left, 0);
+		if (moved <= 0)
+			return (0);
+		left -= moved;
+	}
+	close(sink->pipe_fd[0]);
+	close(sink->pipe_fd[1]);
+	sink->pipe_fd[0] = -1;
+	sink->pipe_fd[1] = -1;
+	return (1);
+}
+
+/**
+ * sink_flush - Writes the staged chunk to the pipe or memfd
+ * @sink: Sink to flush
+ *
+ * Returns: 1 on success, 0 on failure
+ */
+static int	sink_flush(t_hdoc_sink *sink)
+{
+	ssize_t	ret;
+	size_t	done;
+	int		fd;
+
+	if (sink->len == 0)
+		return (1);
+	if (sink->mem_fd == -1 && sink->written + sink->len > sink->pipe_cap
+		&& !sink_spill(sink))
+		return (0);
+	fd = sink->mem_fd;
+	if (fd == -1)
+		fd = sink->pipe_fd[1];
+	done = 0;
+	while (done < sink->len)
+	{
+		ret = write(fd, sink->buf + done, sink->len - done);
+		if (ret <= 0)
+			return (0);
+		done += ret;
+	}
+	sink->written += sink->len;
+	sink->len = 0;
+	return (1);
+}
+
+/**
+ * sink_write - Appends data to the heredoc body
+ * @sink: Sink receiving the body
+ * @data: Bytes to append
+ * @len: Number of bytes
+ *
+ * Data is staged in chunks of HEREDOC_CHUNK bytes so a body costs one
+ * write per chunk rather than one per line.
+ *
+ * Returns: 1 on success, 0 on failure
+ */
+int	sink_write(t_hdoc_sink *sink, char *data, size_t len)
+{
+	size_t	room;
+
+	while (len > 0)
+	{
+		room = HEREDOC_CHUNK - sink->len;
+		if (room > len)
+			room = len;
+		ft_memcpy(sink->buf + sink->len, data, room);
+		sink->len += room;
+		data += room;
+		len -= room;
+		if (sink->len == HEREDOC_CHUNK && !sink_flush(sink))
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * sink_finish - Completes the body and returns a readable descriptor
+ * @sink: Sink to complete
+ *
+ * Returns: Read end of the pipe, or the rewound memfd, or -1 on failure.
+ *          The descriptor is close-on-exec.
+ */
+int	sink_finish(t_hdoc_sink *sink)
+{
+	int	fd;
+
+	if (!sink_flush(sink))
+	{
+		sink_abort(sink);
+		return (-1);
+	}
+	if (sink->mem_fd != -1)
+	{
+		lseek(sink->mem_fd, 0, SEEK_SET);
+		return (sink->mem_fd);
+	}
+	close(sink->pipe_fd[1]);
+	fd = sink->pipe_fd[0];
+	return (fd);
+}
+
+/**
+ * sink_abort - Releases every descriptor held by a sink
+ * @sink: Sink to discard
+ */
+void	sink_abort(t_hdoc_sink *sink)
+{
+	if (sink->mem_fd != -1)
+		close(sink->mem_fd);
+	if (sink->pipe_fd[0] != -1)
+		close(sink->pipe_fd[0]);
+	if (sink->pipe_fd[1] != -1)
+		close(sink->pipe_fd[1]);
+	sink->mem_fd = -1;
+	sink->pipe_fd[0] = -1;
+	sink->pipe_fd[1] = -1;
+}
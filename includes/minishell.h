@@ -7,6 +7,16 @@
 # include <signal.h> 
 # include <sys/types.h> 
 # include <sys/wait.h> 
+# include <fcntl.h>
+# include <unistd.h>
+# include <errno.h>
+# include <string.h>
+# include <limits.h>
+# include <time.h>
+# include <sys/resource.h>
+# include <pthread.h>
+# include <semaphore.h>
+# include "probes.h"
 
 //			ENUMS.C				//
 typedef enum e_token_type
@@ -18,7 +28,12 @@ typedef enum e_token_type
 	TOKEN_REDIR_IN,
 	TOKEN_REDIR_OUT,
 	TOKEN_REDIR_APPEND,
-	TOKEN_HEREDOC
+	TOKEN_HEREDOC,
+	TOKEN_HERESTRING,
+	TOKEN_AND_IF,
+	TOKEN_OR_IF,
+	TOKEN_SEMI,
+	TOKEN_AMP
 }	t_token_type;
 
 typedef enum e_node_type
@@ -28,7 +43,13 @@ typedef enum e_node_type
 	NODE_REDIR_IN,     // Input redirect: < file
 	NODE_REDIR_OUT,    // Output redirect: > file
 	NODE_REDIR_APPEND, // Append redirect: >> file
-	NODE_HEREDOC       // Heredoc: << delimiter
+	NODE_HEREDOC,      // Heredoc: << delimiter
+	NODE_HERESTRING,   // Herestring: <<< word
+	NODE_AND,          // And list: cmd1 && cmd2
+	NODE_OR,           // Or list: cmd1 || cmd2
+	NODE_LIST,         // Sequential list: cmd1 ; cmd2
+	NODE_BACKGROUND,   // Background job: cmd & (job in left)
+	NODE_TIME          // Timed pipeline: time -p cmd (pipeline in left)
 }	t_node_type;
 
 //			TOKENS				//
@@ -41,11 +62,396 @@ typedef struct s_token
 	struct s_token	*next;
 }	t_token;
 
+//			CHILDREN			//
+
+/*
+** Child
+** One child process the shell still has to reap. Children are watched
+** through a pidfd; once the pidfd budget is spent (see t_waitset) a
+** child is tracked by pid only and reaped with a plain waitpid().
+*/
+typedef struct s_child
+{
+	pid_t	pid;
+	int		pidfd;          // pidfd of the child, or -1
+	int		watched;        // 1 once pidfd is registered in the epoll set
+	int		status;         // Exit status once reaped, -1 while running
+	int		used;           // 1 if the slot is taken
+	struct timespec	started;    // CLOCK_MONOTONIC time of waitset_add()
+	struct timespec	ended;      // CLOCK_MONOTONIC time of the reap
+	struct rusage	ru;         // Resources used, filled in by the reap
+}	t_child;
+
+/*
+** Wait Set
+** Slot table of every child of the shell plus the epoll instance their
+** pidfds are registered in. Slots never move, so a slot index is a
+** stable handle (also stored in the epoll event data).
+*/
+# define WAITSET_EVENTS 64
+
+typedef struct s_waitset
+{
+	int		epfd;           // epoll instance, or -1 if unavailable
+	t_child	*slots;
+	int		cap;
+	int		*free_slots;    // Stack of released slot indexes
+	int		free_count;
+	int		pidfds;         // pidfds currently open
+	int		pidfd_budget;   // Max pidfds (half of RLIMIT_NOFILE)
+}	t_waitset;
+
+/*
+** Job
+** A pipeline (or a whole and-or list) launched with '&'. Its stages live
+** in the wait set; the job is done once every slot has been reaped.
+*/
+typedef struct s_job
+{
+	int				id;         // Job number, as in %1
+	int				*slots;     // Wait-set slots of the stages, in order
+	int				n;          // Number of stages launched
+	pid_t			pid;        // Pid of the last stage ($!)
+	char			*cmd;       // Command line, for jobs and notifications
+	struct s_job	*next;
+}	t_job;
+
+/*
+** Parallel Map
+** State of one pmap run: a command template, one run per item and at
+** most `jobs` children alive at a time.
+*/
+typedef struct s_pmap
+{
+	char	**tmpl;         // Command template, may contain {}
+	int		tmpl_len;
+	char	**items;        // One item per run
+	int		count;
+	int		items_owned;    // 1 if items were read from stdin
+	int		jobs;           // Max children running at once
+	int		keep_order;     // 1: buffer output, print in input order
+	int		*slots;         // Wait-set slot of each launched item
+	int		*outputs;       // memfd with the output of each item, or -1
+	int		*status;        // Exit status of each item, -1 until reaped
+	int		next;           // Next item to launch
+	int		printed;        // Next item whose output is printed
+	int		running;
+	int		interrupted;    // 1 once Ctrl-C stopped the launching
+}	t_pmap;
+
+/*
+** Output Buffer
+** Builtins that print (echo, printf) collect their output here and
+** write it once per invocation, or whenever the buffer fills.
+*/
+# define OUTBUF_SIZE 8192
+
+typedef struct s_outbuf
+{
+	int		fd;
+	int		error;          // errno of the first failed write, or 0
+	size_t	len;            // Bytes waiting in buf
+	char	buf[OUTBUF_SIZE];
+}	t_outbuf;
+
+/*
+** Printf
+** State of one printf invocation. spec holds the conversion being
+** printed: flags, width and precision (-1 when not given).
+*/
+typedef struct s_printf
+{
+	t_outbuf	ob;
+	char		**args;         // Arguments after the format
+	int			argi;           // Next argument to consume
+	int			status;         // 1 once an argument was invalid
+	int			stop;           // 1 after \c: no further output
+	char		flags[6];       // Flags of the spec, among "-0+ #"
+	int			width;
+	int			prec;
+}	t_printf;
+
+/*
+** Copy
+** copy_fd() strategies and sizes: in-kernel copies move up to
+** COPY_CHUNK bytes per call, the fallback loop uses a COPY_BUFFER buffer.
+*/
+# define COPY_RANGE 1
+# define COPY_SENDFILE 2
+# define COPY_SPLICE 3
+# define COPY_CHUNK 1073741824
+# define COPY_BUFFER 131072
+
+/*
+** Test
+** Arguments of a test/[ builtin being evaluated. ac excludes the
+** closing "]"; pos is the next argument to consume.
+*/
+typedef struct s_test
+{
+	char	*name;          // "test" or "[", for error messages
+	char	**av;
+	int		ac;
+	int		pos;
+	int		error;          // 1 once a syntax error was reported
+}	t_test;
+
+/*
+** Environment Index
+** shell->envp stays the NULL-terminated array handed to execve(). The
+** index finds a name in it through an open-addressed hash table and
+** keeps its slots sorted by name for `export`.
+*/
+typedef struct s_env_index
+{
+	int		len;            // Variables in envp
+	int		cap;            // Variables envp has room for
+	int		*table;         // Name hash -> envp slot, -1 when empty
+	int		size;           // Buckets in table (power of two)
+	int		*order;         // envp slots sorted by name
+}	t_env_index;
+
+/*
+** Working Directory
+** Logical working directory kept by cd, as exported in PWD. dev and ino
+** identify the directory it named when cd went there, so pwd can tell
+** a stale path with one stat() instead of calling getcwd().
+*/
+typedef struct s_cwd
+{
+	char	*path;
+	dev_t	dev;
+	ino_t	ino;
+}	t_cwd;
+
+/*
+** Trace
+** Stage spans of the shell loop, kept when MINISHELL_TRACE names a file
+** and written there as Chrome trace-event JSON on exit. The ring holds
+** the last TRACE_SPANS spans and is allocated once. With tracing off
+** shell->trace is NULL and the macros reduce to one branch each; the
+** four stages shellstats times still cost two vDSO clock reads each
+** per line.
+*/
+# define TRACE_SPANS 4096
+
+typedef struct s_span
+{
+	const char	*name;
+	long		start;          // trace_now() at the beginning, in ns
+	long		dur;
+}	t_span;
+
+typedef struct s_trace
+{
+	t_span	*spans;
+	long	count;          // Spans recorded so far, ring index = count % N
+	long	origin;         // trace_now() when tracing started
+	pid_t	pid;            // Only this process writes the file
+	char	*path;
+}	t_trace;
+
+# define TRACE_BEGIN(t) ((t) ? trace_now() : 0)
+# define TRACE_END(t, name, start) \
+	do { if (t) trace_span(t, name, start); } while (0)
+
+/*
+** Session Statistics
+** Counters reported by `shellstats`. Each costs one increment (stages
+** one clock read at each end), so they are always kept. Time spent
+** expanding list members as they run counts in STAT_EXEC too; time
+** spent collecting heredocs is in no stage.
+*/
+# define STAT_LEX 0
+# define STAT_PARSE 1
+# define STAT_EXPAND 2
+# define STAT_EXEC 3
+# define STAT_STAGES 4
+
+typedef struct s_stats
+{
+	long	lines;
+	long	tokens;
+	long	nodes;          // AST nodes, redirections not included
+	long	expanded;       // Words and redirection targets expanded
+	long	unexpanded;     // Single-quoted ones, left as they are
+	long	forks;
+	long	builtins;       // Builtins run in the shell process
+	long	ns[STAT_STAGES];// Cumulative time per stage
+}	t_stats;
+
+/*
+** Memory Accounting
+** With --mem-stats every allocation is charged to the stage the shell
+** is in (see mem.c) and each line ends with a one-line summary on
+** stderr. Peaks are live bytes above the start of the line.
+*/
+# define MEM_IDLE 0
+# define MEM_LEXING 1
+# define MEM_PARSING 2
+# define MEM_EXPANDING 3
+# define MEM_EXECUTING 4
+# define MEM_STAGES 5
+
+typedef struct s_mem_stage
+{
+	long	calls;          // malloc, calloc and realloc calls
+	long	bytes;          // Usable bytes they returned
+	long	peak;           // Highest live bytes above the line's start
+}	t_mem_stage;
+
+typedef struct s_mem
+{
+	int			on;
+	int			stage;          // MEM_* the allocations are charged to
+	long		live;           // Live bytes seen by the wrappers
+	long		start;          // live when the line started
+	t_mem_stage	stages[MEM_STAGES];
+}	t_mem;
+
+/*
+** Audit Log
+** With MINISHELL_AUDIT naming a file, every command line is appended
+** there as one JSON object per line. The shell only copies a record into
+** the ring; a writer thread formats and writes them in batches, so the
+** prompt never waits on the disk. When the writer falls AUDIT_RING
+** records behind, new records are counted as dropped instead.
+*/
+# define AUDIT_RING 256
+# define AUDIT_CMD 1024
+# define AUDIT_CWD 512
+# define AUDIT_SYNC_MS 1000
+# define AUDIT_REC_MAX (6 * (AUDIT_CMD + AUDIT_CWD) + 256)
+
+typedef struct s_audit_rec
+{
+	struct timespec	start;          // CLOCK_REALTIME when the line started
+	long			dur_ns;
+	int				status;
+	int				truncated;      // cmd was longer than AUDIT_CMD - 1
+	char			cmd[AUDIT_CMD];
+	char			cwd[AUDIT_CWD];
+}	t_audit_rec;
+
+typedef struct s_audit_batch
+{
+	size_t	len;
+	long	recs;           // Records formatted into buf
+	char	buf[8 * AUDIT_REC_MAX];
+}	t_audit_batch;
+
+typedef struct s_audit
+{
+	int				fd;
+	pid_t			pid;            // Only this process has the writer thread
+	pthread_t		writer;
+	sem_t			wake;           // Posted once per record and on close
+	size_t			head;           // Next slot the shell fills
+	size_t			tail;           // Next slot the writer reads
+	int				stop;
+	long			dropped;        // Lost to a full ring or a failed write
+	long			reported;       // Of those, already logged by the writer
+	struct timespec	start;          // Line being run, CLOCK_REALTIME
+	long			t0;             // trace_now() when it started
+	t_audit_rec		ring[AUDIT_RING];
+}	t_audit;
+
+/*
+** Read Buffer
+** Input of the `read` builtin, kept in the shell between invocations.
+** On a regular file it holds up to READ_BLOCK bytes read ahead of the
+** descriptor offset; off, dev and ino tell which file and where.
+*/
+# define READ_BLOCK 65536
+
+typedef struct s_readbuf
+{
+	char	*data;
+	size_t	cap;
+	size_t	len;            // Bytes held in data
+	size_t	pos;            // First byte not handed out yet
+	off_t	off;            // File offset of data[pos], or -1
+	dev_t	dev;
+	ino_t	ino;
+	char	delim;          // Line delimiter of the current `read`
+}	t_readbuf;
+
+/*
+** Read
+** One line being split by `read`: fields are unescaped in place and
+** handed to env_set() without further copies.
+*/
+typedef struct s_read
+{
+	char	*line;
+	size_t	len;
+	size_t	i;              // Next byte to split
+	char	*ifs;
+	int		raw;            // -r: backslashes are ordinary characters
+}	t_read;
+
+/*
+** Bench
+** One `bench` measurement: a pipeline parsed once and run `runs` times
+** after `warmup` unmeasured runs.
+*/
+typedef struct s_bench
+{
+	char		*line;          // Command line being measured
+	int			runs;
+	int			warmup;
+	double		*samples;       // Wall time of each measured run, in ms
+	int			done;           // Measured runs completed
+}	t_bench;
+
+/*
+** Timing
+** Filled in while a `time` pipeline runs: every foreground child reaped
+** through set_pipestatus() adds one stage, in pipeline order.
+*/
+# define TIME_POSIX 1
+# define TIME_STAGES 2
+# define TIME_JSON 4
+
+typedef struct s_stage_time
+{
+	pid_t			pid;
+	int				status;
+	double			real;       // Seconds from fork to reap
+	struct rusage	ru;
+}	t_stage_time;
+
+typedef struct s_timing
+{
+	int				flags;      // TIME_POSIX, TIME_STAGES, TIME_JSON
+	t_stage_time	*stages;
+	int				count;
+	double			real;       // Wall time of the whole pipeline
+	struct rusage	self;       // Time the shell itself spent (builtins)
+	int				status;
+}	t_timing;
+
+# define STAGE_LAST 1
+# define STAGE_ASYNC 2
+
 typedef struct s_shell
 {
 	char	*line;
 	char	**envp;
+	t_env_index	env;            // Hash and sorted index of envp
 	int	exit_status;
+	t_waitset	children;       // Every child not reaped yet
+	int		*pipestatus;    // Statuses of the last foreground pipeline
+	int		pipestatus_len;
+	t_job	*jobs;          // Background jobs, oldest first
+	pid_t	last_bg;        // Pid of the last background job, or 0
+	t_timing	*timing;        // Report of the running `time`, or NULL
+	t_readbuf	readbuf;        // Read-ahead of the `read` builtin
+	t_cwd		cwd;            // Logical working directory (PWD)
+	t_trace		*trace;         // Stage spans, or NULL when not tracing
+	int			mem_stats;      // --mem-stats: allocations report per line
+	t_stats		stats;          // Counters of the shellstats builtin
+	t_audit		*audit;         // Command log, or NULL when not auditing
 
 } t_shell;
 
@@ -58,6 +464,7 @@ typedef struct s_redir_node
 	t_node_type			type;       // REDIR_IN, REDIR_OUT, REDIR_APPEND, HEREDOC
 	char				*file;      // Filename or heredoc delimiter (unexpanded)
 	int				quoted;
+	int				fd;         // Collected heredoc/herestring body, or -1
 	struct s_redir_node	*next;      // Next redirection in the list
 }	t_redir_node;
 
@@ -87,6 +494,38 @@ typedef struct s_parser
 	char		*error_msg;     // Error message if parsing fails
 }	t_parser;
 
+/*
+** Heredoc Sink
+** Receives a heredoc body in chunks. The body is written straight into a
+** pipe while it fits the pipe capacity and moved to a memfd once it does not.
+*/
+# define HEREDOC_CHUNK 4096
+
+typedef struct s_hdoc_sink
+{
+	int			pipe_fd[2];     // Pipe holding the body while it fits
+	int			mem_fd;         // memfd once the body outgrew the pipe, or -1
+	size_t		pipe_cap;       // Capacity of pipe_fd (F_GETPIPE_SZ)
+	size_t		written;        // Bytes already flushed to the pipe/memfd
+	size_t		len;            // Bytes staged in buf
+	char		buf[HEREDOC_CHUNK];
+}	t_hdoc_sink;
+
+/*
+** Redirection Plan
+** Final descriptors of a command's stdin/stdout once all of its
+** redirections are open. -1 leaves the stream as inherited.
+*/
+typedef struct s_redir_plan
+{
+	int	in;             // Final stdin source, or -1
+	int	out;            // Final stdout target, or -1
+	int	in_owned;       // 1 if in was opened by the plan (not a heredoc)
+	int	out_owned;      // 1 if out was opened by the plan
+	int	saved_in;       // Shell's own stdin while a builtin runs, or -1
+	int	saved_out;      // Shell's own stdout while a builtin runs, or -1
+}	t_redir_plan;
+
 
 
 //			main.c			//
@@ -100,6 +539,9 @@ char	*ft_readline(char *prompt, t_shell *shell);
 //			signals.c			//
 
 void	setup_signals(void);
+void	setup_exec_signals(void);
+void	setup_wait_signals(void);
+int		sigint_received(void);
 void	sigint_handler(int sig);
 
 //			init.c				//
@@ -110,6 +552,8 @@ char	**init_envp(char **envp, t_shell *shell);
 //			utils.c				//
 
 void	*control_malloc(size_t size, t_shell *shell);
+void	deadline_init(struct timespec *deadline, int timeout_ms);
+int		deadline_left(struct timespec *deadline, int timeout_ms);
 
 
 
@@ -117,6 +561,7 @@ void	*control_malloc(size_t size, t_shell *shell);
 
 void	free_shell(t_shell *shell);
 void	free_array(char **envp);
+void	env_free(t_shell *shell);
 
 
 //			lexer.c				//
@@ -129,7 +574,7 @@ int	lexer_loop(t_token **tokens, char *input, int *i, int *quote_state);
 
 //			lexer_utils.c			//
 
-int	handle_pipe(t_token **tokens, int *i);
+int	handle_pipe(t_token **tokens, char *input, int *i);
 int	handle_less(t_token **tokens, char *input, int *i);
 int	handle_greater(t_token **tokens, char *input, int *i);
 int	handle_operators(t_token **tokens, char *input, int *i);
@@ -139,11 +584,14 @@ int	advance_word_pos(char *input, int *i, int quote_state, char quote_char);
 
 int	ft_isoperator(char c);
 void	skip_whitespace(char *input, int *i);
+int	handle_amp(t_token **tokens, char *input, int *i);
+int	handle_semi(t_token **tokens, int *i);
 
 
 
 //			lexer_utils_tokens.c		//
 t_token	*token_new(t_token_type type, char *value, int quoted);
+long	token_total(void);
 void	token_del(t_token *token);
 void	token_lstclear(t_token **head);
 void	token_lstadd_back(t_token **head, t_token *new);
@@ -152,7 +600,10 @@ void	token_print(t_token *token);
 
 //			parser.c			//
 t_ast_node      *parse(t_token *tokens);
+t_ast_node      *parse_list(t_parser *parser);
+t_ast_node      *parse_and_or(t_parser *parser);
 t_ast_node      *parse_pipeline(t_parser *parser);
+t_ast_node      *parse_time(t_parser *parser);
 t_ast_node      *parse_command(t_parser *parser);
 void	parser_init(t_parser *parser, t_token *tokens);
 void	print_parser_error(t_parser *parser);
@@ -173,16 +624,20 @@ t_token	*next_token(t_parser *parser);
 int	match_token(t_parser *parser, t_token_type type);
 void	parser_error(t_parser *parser, char *msg);
 t_ast_node	*create_pipe_node(t_ast_node *left, t_ast_node *right);
+t_ast_node	*create_list_node(t_node_type type, t_ast_node *left,
+				t_ast_node *right);
 
 //			parser_syntax.c			//
 
 int	validate_syntax(t_token *tokens);
 int	validate_pipes(t_token *tokens);
+int	validate_lists(t_token *tokens);
 int	validate_redirects(t_token *tokens);
 
 //			parse_node_utils.c		//
 
 t_ast_node	*ast_new_node(t_node_type type);
+long		ast_node_total(void);
 t_redir_node *redir_new_node(t_node_type type, char *file, int quoted);
 void	free_args(char **args);
 void	redir_free(t_redir_node *redir);
@@ -198,12 +653,224 @@ void	print_redirects(t_redir_node *redir, int depth);
 void	ast_print(t_ast_node *node, int depth);
 int	is_redir_type(t_node_type type);
 int	is_redir_token(t_token_type type);
+int	is_control_token(t_token_type type);
+int	is_list_node(t_node_type type);
+int	is_time_keyword(t_token *token);
 t_node_type	token_to_node_type(t_token_type token_type);
 int	ast_has_pipes(t_ast_node *node);
 int	ast_count_pipes(t_ast_node *node);
 int	ast_count_commands(t_ast_node *node);
 void	redir_lstclear(t_redir_node **head);
 
+//			redirect.c			//
+
+int		redirect_open(t_redir_node *redir, t_redir_plan *plan);
+int		redirect_apply(t_redir_plan *plan);
+int		redirect_child(t_redir_plan *plan);
+void	redirect_close(t_redir_plan *plan);
+
+//			redirect_utils.c		//
+
+int		redirect_save(t_redir_plan *plan);
+void	redirect_restore(t_redir_plan *plan);
+
+//			executor.c			//
+
+int		execute_ast(t_ast_node *ast, t_shell *shell);
+int		execute_command(t_ast_node *cmd, t_shell *shell);
+int		spawn_wait(t_shell *shell, pid_t pid);
+
+//			pipeline.c			//
+
+int		launch_pipeline(t_ast_node *ast, t_shell *shell, t_job *job,
+			int async);
+int		execute_pipeline(t_ast_node *ast, t_shell *shell);
+
+//			pmap.c				//
+
+int		pmap_run(t_pmap *p, t_shell *shell);
+int		pmap_read_items(t_pmap *p);
+
+//			bench.c				//
+
+int		bench_run(t_bench *b, t_ast_node *ast, t_shell *shell);
+void	bench_report(t_bench *b);
+
+//			outbuf.c			//
+
+void	outbuf_init(t_outbuf *ob, int fd);
+int		outbuf_flush(t_outbuf *ob);
+void	outbuf_write(t_outbuf *ob, const char *data, size_t len);
+void	outbuf_putc(t_outbuf *ob, char c);
+void	outbuf_puts(t_outbuf *ob, const char *s);
+void	outbuf_putnum(t_outbuf *ob, long n);
+
+//			readbuf.c			//
+
+int		readbuf_line(t_readbuf *rb, int fd, char **line, size_t *len);
+
+//			env_store.c			//
+
+int		env_init(t_shell *shell);
+int		env_find(t_shell *shell, const char *name, size_t len);
+int		env_put(t_shell *shell, char *entry);
+int		env_set(t_shell *shell, char *name, char *value, size_t len);
+void	env_unset(t_shell *shell, char *name);
+
+//			trace.c				//
+
+long	trace_now(void);
+void	trace_init(t_shell *shell);
+void	trace_span(t_trace *t, const char *name, long start);
+void	trace_dump(t_shell *shell);
+
+//			stats.c				//
+
+void	stats_stage(t_shell *shell, int stage, long start);
+
+//			mem.c				//
+
+int		mem_stage(int stage);
+void	mem_stats_start(void);
+void	mem_stats_report(void);
+long	mem_live(void);
+
+//			audit.c				//
+
+void	audit_init(t_shell *shell);
+void	audit_begin(t_shell *shell);
+void	audit_record(t_shell *shell, char *line);
+void	audit_close(t_shell *shell);
+
+//			audit_writer.c		//
+
+void	*audit_writer(void *arg);
+
+//			cwd.c				//
+
+char	*cwd_canon(const char *base, const char *path);
+void	cwd_set(t_shell *shell, char *path);
+void	cwd_init(t_shell *shell);
+char	*cwd_get(t_shell *shell);
+
+//			env_index.c			//
+
+size_t	env_name_len(const char *entry);
+int		env_bucket(t_env_index *ix, char **envp, const char *name,
+			size_t len);
+int		env_table_build(t_env_index *ix, char **envp);
+void	env_table_remove(t_env_index *ix, char **envp, int b);
+
+//			env_order.c			//
+
+int		env_order_find(t_env_index *ix, char **envp, const char *name,
+			size_t len);
+void	env_order_insert(t_env_index *ix, char **envp, int slot);
+void	env_order_remove(t_env_index *ix, char **envp, int slot);
+void	env_order_move(t_env_index *ix, char **envp, int to);
+
+//			copy.c				//
+
+int		copy_fd(int in, int out);
+
+//			list.c				//
+
+int		execute_list(t_ast_node *ast, t_shell *shell);
+int		execute_member(t_ast_node *node, t_shell *shell);
+
+//			time.c				//
+
+int		execute_time(t_ast_node *ast, t_shell *shell);
+void	timing_record(t_timing *timing, t_waitset *ws, int *slots, int n);
+
+//			time_report.c			//
+
+void	time_report(t_timing *timing, t_ast_node *pipeline);
+
+//			jobs.c				//
+
+int		launch_job(t_ast_node *ast, t_shell *shell);
+t_job	*job_find(t_shell *shell, char *spec);
+int		job_finish(t_shell *shell, t_job *job);
+void	jobs_notify(t_shell *shell);
+void	jobs_clear(t_shell *shell);
+
+//			jobs_utils.c			//
+
+char	*job_command_line(t_ast_node *ast);
+void	job_print(t_shell *shell, t_job *job);
+void	async_child(int first);
+
+//			reap.c				//
+
+int		waitset_init(t_waitset *ws);
+int		waitset_add(t_waitset *ws, pid_t pid);
+int		waitset_wait(t_waitset *ws, int *slots, int n, int timeout_ms);
+int		waitset_wait_any(t_waitset *ws, int *slots, int n);
+int		waitset_reap(t_waitset *ws, int slot, int options);
+void	waitset_free(t_waitset *ws);
+
+//			reap_utils.c			//
+
+int		waitset_reserve(t_waitset *ws, int n);
+void	waitset_release(t_waitset *ws, int slot);
+int		waitset_watch(t_waitset *ws, int slot);
+int		waitset_pending(t_waitset *ws, int *slots, int n);
+int		waitset_running(t_waitset *ws, int *slots, int n);
+
+//			pipestatus.c			//
+
+int		set_pipestatus(t_shell *shell, int *slots, int n);
+int		record_status(t_shell *shell, int status);
+char	*pipestatus_string(t_shell *shell);
+
+//			exec_path.c			//
+
+void	exec_command(char **args, t_shell *shell);
+void	reset_child_signals(void);
+
+//			builtins/			//
+
+int		is_builtin(char *name);
+int		exec_builtin(t_ast_node *cmd, t_shell *shell);
+pid_t	control_fork(void);
+int		builtin_echo(t_ast_node *cmd);
+int		builtin_cd(t_ast_node *cmd, t_shell *shell);
+int		builtin_pwd(t_ast_node *cmd, t_shell *shell);
+int		builtin_export(t_ast_node *cmd, t_shell *shell);
+int		builtin_unset(t_ast_node *cmd, t_shell *shell);
+int		builtin_env(t_ast_node *cmd, t_shell *shell);
+int		builtin_exit(t_ast_node *cmd, t_shell *shell);
+int		builtin_jobs(t_ast_node *cmd, t_shell *shell);
+int		builtin_wait(t_ast_node *cmd, t_shell *shell);
+int		builtin_pmap(t_ast_node *cmd, t_shell *shell);
+int		builtin_bench(t_ast_node *cmd, t_shell *shell);
+int		builtin_test(t_ast_node *cmd);
+int		builtin_cat(t_ast_node *cmd, t_shell *shell);
+int		builtin_printf(t_ast_node *cmd);
+int		builtin_read(t_ast_node *cmd, t_shell *shell);
+int		builtin_shellstats(t_ast_node *cmd, t_shell *shell);
+int		printf_escape(char *s, int in_arg, char *out);
+void	printf_string(t_printf *p, char *str, size_t len);
+void	printf_number(t_printf *p, char conv, char *arg);
+int		builtin_write_error(char *name, t_outbuf *ob);
+int		test_error(t_test *t, char *arg, char *msg);
+int		is_test_unary(char *op);
+int		is_test_binary(char *op);
+int		test_unary(t_test *t, char *op, char *arg);
+int		test_binary(t_test *t, char *left, char *op, char *right);
+
+//			heredoc.c			//
+
+int		collect_heredocs(t_ast_node *ast, t_shell *shell);
+
+//			heredoc_sink.c			//
+
+int		sink_open(t_hdoc_sink *sink);
+int		sink_write(t_hdoc_sink *sink, char *data, size_t len);
+int		sink_finish(t_hdoc_sink *sink);
+void	sink_abort(t_hdoc_sink *sink);
+
 //			expander			//
 // Expander functions
 int		expand_ast(t_ast_node *ast, t_shell *shell);
@@ -0,0 +1,34 @@
+#ifndef PROBES_H
+# define PROBES_H
+
+/*
+** USDT Probes
+** Static probes at the stage boundaries of the shell loop, for perf and
+** bpftrace to attach to a running shell (see stage_latency.bt). With
+** <sys/sdt.h> each probe is a nop plus an ELF note, and its arguments
+** are values the shell keeps anyway. Without the header every macro
+** compiles to nothing.
+**
+**   line_read(line)          lexer_start()   lexer_end(tokens)
+**   parse_start()            parse_end(nodes)
+**   expand_start()           expand_end(ok)
+**   cmd_spawn(pid)           cmd_exit(pid, status)
+*/
+# if defined(__has_include)
+#  if __has_include(<sys/sdt.h>) && !defined(MINISHELL_NO_PROBES)
+#   define MINISHELL_USDT 1
+#  endif
+# endif
+
+# ifdef MINISHELL_USDT
+#  include <sys/sdt.h>
+#  define PROBE0(name) STAP_PROBE(minishell, name)
+#  define PROBE1(name, a) STAP_PROBE1(minishell, name, a)
+#  define PROBE2(name, a, b) STAP_PROBE2(minishell, name, a, b)
+# else
+#  define PROBE0(name) do { } while (0)
+#  define PROBE1(name, a) do { (void)(a); } while (0)
+#  define PROBE2(name, a, b) do { (void)(a); (void)(b); } while (0)
+# endif
+
+#endif
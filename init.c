@@ -34,5 +34,17 @@ char	**init_envp(char **envp, t_shell *shell)
 void	init_shell(char **envp, t_shell *shell)
 {
 	shell->envp = init_envp(envp, shell);
+	if (!env_init(shell))
+	{
+		ft_printf("Problema com o malloc\n");
+		exit(69);
+	}
+	cwd_init(shell);
 	shell->exit_status = 0;
+	shell->pipestatus = NULL;
+	shell->pipestatus_len = 0;
+	shell->jobs = NULL;
+	shell->last_bg = 0;
+	shell->readbuf.off = -1;
+	waitset_init(&shell->children);
 }
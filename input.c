@@ -10,7 +10,9 @@ char	*ft_readline(char *prompt, t_shell *shell)
 	if (!line)
 	{
 		ft_printf("exit\n");
-		free_array(shell->envp);
+		trace_dump(shell);
+		audit_close(shell);
+		env_free(shell);
 		exit(0);
 	}
 	else if (line && ft_strcmp(line, "\n") != 0)
@@ -0,0 +1,226 @@
+#include "includes/minishell.h"
+
+/**
+ * job_register - Appends a launched job to the job table
+ * @shell: Shell context
+ * @launched: Slots and pid filled by the launcher (copied)
+ * @cmd: Command line of the job (owned by the job from now on)
+ *
+ * Job numbers keep growing while the table is not empty, like bash.
+ *
+ * Returns: The new job, or NULL on allocation failure
+ */
+static t_job	*job_register(t_shell *shell, t_job *launched, char *cmd)
+{
+	t_job	*job;
+	t_job	**tail;
+
+	job = malloc(sizeof(t_job));
+	if (!job)
+		return (NULL);
+	*job = *launched;
+	job->cmd = cmd;
+	job->id = 1;
+	job->next = NULL;
+	tail = &shell->jobs;
+	while (*tail)
+	{
+		job->id = (*tail)->id + 1;
+		tail = &(*tail)->next;
+	}
+	*tail = job;
+	shell->last_bg = job->pid;
+	return (job);
+}
+
+/**
+ * launch_subshell - Forks a shell that runs an and-or list
+ * @ast: NODE_AND, NODE_OR or NODE_TIME
+ * @shell: Shell context
+ * @job: Receives the single slot of the subshell
+ *
+ * The subshell starts from an empty wait set and job table: it must not
+ * share the parent's epoll instance or try to reap the parent's jobs.
+ *
+ * Returns: 1 if the subshell was launched, 0 otherwise
+ */
+static int	launch_subshell(t_ast_node *ast, t_shell *shell, t_job *job)
+{
+	pid_t	pid;
+
+	job->n = 0;
+	job->slots = malloc(sizeof(int));
+	if (!job->slots || !waitset_reserve(&shell->children, 1))
+		return (0);
+	pid = control_fork();
+	if (pid == -1)
+		return (0);
+	if (pid == 0)
+	{
+		reset_child_signals();
+		async_child(1);
+		jobs_clear(shell);
+		waitset_free(&shell->children);
+		waitset_init(&shell->children);
+		exit(execute_member(ast, shell));
+	}
+	job->pid = pid;
+	job->slots[job->n++] = waitset_add(&shell->children, pid);
+	shell->stats.forks++;
+	return (1);
+}
+
+/**
+ * launch_job - Starts an and-or list in the background
+ * @ast: Left child of a NODE_BACKGROUND node
+ * @shell: Shell context
+ *
+ * A pipeline is launched directly, one process per stage, and its stages
+ * go in the wait set like any other children. An and-or list needs a
+ * shell to decide what runs next, and `time` one to wait and report, so
+ * they get a subshell. Nothing is
+ * waited for; "[id] pid" is printed when the shell is interactive.
+ *
+ * Returns: 0, or 1 if the job could not be launched
+ */
+int	launch_job(t_ast_node *ast, t_shell *shell)
+{
+	t_job	launched;
+	t_job	*job;
+	char	*cmd;
+
+	cmd = job_command_line(ast);
+	launched.n = 0;
+	launched.slots = NULL;
+	if (is_list_node(ast->type) || ast->type == NODE_TIME)
+		launch_subshell(ast, shell, &launched);
+	else if (expand_ast(ast, shell))
+		launch_pipeline(ast, shell, &launched, 1);
+	job = NULL;
+	if (launched.n > 0 && cmd)
+		job = job_register(shell, &launched, cmd);
+	if (!job)
+	{
+		waitset_wait(&shell->children, launched.slots, launched.n, -1);
+		while (launched.n > 0)
+			waitset_release(&shell->children, launched.slots[--launched.n]);
+		free(launched.slots);
+		free(cmd);
+		return (record_status(shell, 1));
+	}
+	if (isatty(STDIN_FILENO))
+	{
+		ft_putchar_fd('[', 2);
+		ft_putnbr_fd(job->id, 2);
+		ft_putstr_fd("] ", 2);
+		ft_putnbr_fd(job->pid, 2);
+		ft_putchar_fd('\n', 2);
+	}
+	return (record_status(shell, 0));
+}
+
+/**
+ * job_find - Looks up a job from a wait/jobs operand
+ * @shell: Shell context
+ * @spec: "%N" for job N, "%%" or "%+" for the current job, or a pid
+ *
+ * A pid matches the job if it is the pid of any of its stages.
+ *
+ * Returns: The job, or NULL if there is no such job
+ */
+t_job	*job_find(t_shell *shell, char *spec)
+{
+	t_job	*job;
+	t_job	*last;
+	int		i;
+
+	last = NULL;
+	job = shell->jobs;
+	while (job)
+	{
+		if (spec[0] == '%' && ft_atoi(spec + 1) == job->id)
+			return (job);
+		i = 0;
+		while (spec[0] != '%' && i < job->n)
+		{
+			if (shell->children.slots[job->slots[i++]].pid == ft_atoi(spec))
+				return (job);
+		}
+		last = job;
+		job = job->next;
+	}
+	if (!ft_strcmp(spec, "%%") || !ft_strcmp(spec, "%+"))
+		return (last);
+	return (NULL);
+}
+
+/**
+ * job_finish - Removes a finished job from the table
+ * @shell: Shell context
+ * @job: Job whose stages have all been reaped
+ *
+ * Returns: Exit status of the last stage of the job
+ */
+int	job_finish(t_shell *shell, t_job *job)
+{
+	t_job	**link;
+	int		status;
+
+	status = shell->children.slots[job->slots[job->n - 1]].status;
+	link = &shell->jobs;
+	while (*link && *link != job)
+		link = &(*link)->next;
+	if (*link)
+		*link = job->next;
+	while (job->n > 0)
+		waitset_release(&shell->children, job->slots[--job->n]);
+	free(job->slots);
+	free(job->cmd);
+	free(job);
+	return (status);
+}
+
+/**
+ * jobs_notify - Reports the background jobs that finished
+ * @shell: Shell context
+ *
+ * Called before each prompt. Jobs are only polled, never waited for;
+ * finished ones are printed like "[1]+  Done    make a" and dropped.
+ */
+void	jobs_notify(t_shell *shell)
+{
+	t_job	*job;
+	t_job	*next;
+
+	job = shell->jobs;
+	while (job)
+	{
+		next = job->next;
+		if (waitset_wait(&shell->children, job->slots, job->n, 0) == 0)
+		{
+			job_print(shell, job);
+			job_finish(shell, job);
+		}
+		job = next;
+	}
+}
+
+/**
+ * jobs_clear - Forgets every job without waiting for it
+ * @shell: Shell context
+ *
+ * Used on exit and in subshells; the slots go with the wait set.
+ */
+void	jobs_clear(t_shell *shell)
+{
+	t_job	*next;
+
+	while (shell->jobs)
+	{
+		next = shell->jobs->next;
+		free(shell->jobs->slots);
+		free(shell->jobs->cmd);
+		free(shell->jobs);
+		shell->jobs = next;
+	}
+}
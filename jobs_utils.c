@@ -0,0 +1,184 @@
+#include "includes/minishell.h"
+
+/**
+ * append_text - Appends a string to a growing command line
+ * @text: Current text (freed), or NULL after an earlier failure
+ * @more: String to append, or NULL
+ *
+ * Returns: New text, or NULL on error
+ */
+static char	*append_text(char *text, char *more)
+{
+	char	*joined;
+
+	joined = NULL;
+	if (text && more)
+		joined = ft_strjoin(text, more);
+	free(text);
+	return (joined);
+}
+
+/**
+ * redir_text - Operator of a redirection as typed on the line
+ * @type: Redirection node type
+ *
+ * Returns: Static string such as ">>"
+ */
+static char	*redir_text(t_node_type type)
+{
+	if (type == NODE_REDIR_IN)
+		return ("<");
+	if (type == NODE_REDIR_APPEND)
+		return (">>");
+	if (type == NODE_HEREDOC)
+		return ("<<");
+	if (type == NODE_HERESTRING)
+		return ("<<<");
+	return (">");
+}
+
+/**
+ * command_text - Rebuilds the text of a simple command
+ * @cmd: NODE_COMMAND node
+ *
+ * Returns: Allocated string, or NULL on error
+ */
+static char	*command_text(t_ast_node *cmd)
+{
+	t_redir_node	*redir;
+	char			*text;
+	int				i;
+
+	text = ft_strdup("");
+	i = 0;
+	while (cmd->args && cmd->args[i])
+	{
+		if (i > 0)
+			text = append_text(text, " ");
+		text = append_text(text, cmd->args[i++]);
+	}
+	redir = cmd->redirects;
+	while (redir)
+	{
+		if (i++ > 0)
+			text = append_text(text, " ");
+		text = append_text(text, redir_text(redir->type));
+		text = append_text(text, redir->file);
+		redir = redir->next;
+	}
+	return (text);
+}
+
+/**
+ * time_text - Rebuilds the text of a timed pipeline
+ * @ast: NODE_TIME node
+ *
+ * Returns: Allocated string such as "time -p make", or NULL on error
+ */
+static char	*time_text(t_ast_node *ast)
+{
+	char	*text;
+	char	*more;
+
+	text = ft_strdup("time");
+	more = command_text(ast);
+	if (more && more[0])
+		text = append_text(append_text(text, " "), more);
+	free(more);
+	if (!ast->left)
+		return (text);
+	more = job_command_line(ast->left);
+	text = append_text(append_text(text, " "), more);
+	free(more);
+	return (text);
+}
+
+/**
+ * job_command_line - Rebuilds the command line of a job for display
+ * @ast: Pipeline, command or and-or list of the job (not yet expanded)
+ *
+ * Returns: Allocated string such as "make a | tee log", or NULL on error
+ */
+char	*job_command_line(t_ast_node *ast)
+{
+	char	*text;
+	char	*right;
+
+	if (!ast)
+		return (ft_strdup(""));
+	if (ast->type == NODE_COMMAND)
+		return (command_text(ast));
+	if (ast->type == NODE_TIME)
+		return (time_text(ast));
+	text = job_command_line(ast->left);
+	if (ast->type == NODE_AND)
+		text = append_text(text, " && ");
+	else if (ast->type == NODE_OR)
+		text = append_text(text, " || ");
+	else
+		text = append_text(text, " | ");
+	right = job_command_line(ast->right);
+	text = append_text(text, right);
+	free(right);
+	return (text);
+}
+
+/**
+ * job_print - Prints one line of the job table
+ * @shell: Shell context
+ * @job: Job to print
+ *
+ * Format follows bash: "[2]+  Running                 make b". The
+ * most recent job is marked '+', the one before it '-'.
+ */
+void	job_print(t_shell *shell, t_job *job)
+{
+	t_job	*last;
+	t_job	*prev;
+	char	mark;
+	int		status;
+
+	prev = NULL;
+	last = shell->jobs;
+	while (last && last->next)
+	{
+		prev = last;
+		last = last->next;
+	}
+	mark = ' ';
+	if (job == last)
+		mark = '+';
+	else if (job == prev)
+		mark = '-';
+	status = shell->children.slots[job->slots[job->n - 1]].status;
+	if (waitset_running(&shell->children, job->slots, job->n) > 0)
+		printf("[%d]%c  %-24s%s\n", job->id, mark, "Running", job->cmd);
+	else if (status == 0)
+		printf("[%d]%c  %-24s%s\n", job->id, mark, "Done", job->cmd);
+	else
+		printf("[%d]%c  Exit %-19d%s\n", job->id, mark, status, job->cmd);
+	fflush(stdout);
+}
+
+/**
+ * async_child - Prepares a child of a background job
+ * @first: 1 if the child is the first stage (reads the terminal otherwise)
+ *
+ * Without job control a background job must not be killed by Ctrl-C nor
+ * steal input from the terminal, so it ignores SIGINT/SIGQUIT and its
+ * first stage reads /dev/null unless redirected.
+ */
+void	async_child(int first)
+{
+	int	fd;
+
+	signal(SIGINT, SIG_IGN);
+	signal(SIGQUIT, SIG_IGN);
+	if (!first)
+		return ;
+	fd = open("/dev/null", O_RDONLY);
+	if (fd == -1)
+		return ;
+	dup2(fd, STDIN_FILENO);
+	close(fd);
+}
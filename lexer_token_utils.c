@@ -1,5 +1,14 @@
 #include "includes/minishell.h"
 
+// tokens criados desde o arranque, sem os EOF: o shellstats conta-os aqui
+// em vez de percorrer a lista de cada linha
+static long	g_token_total;
+
+long	token_total(void)
+{
+	return (g_token_total);
+}
+
 t_token	*token_new(t_token_type type, char *value, int quoted)
 {
 	t_token	*token;
@@ -7,6 +16,7 @@ t_token	*token_new(t_token_type type, char *value, int quoted)
 	token = malloc(sizeof(t_token));
 	if (!token)
 		return (NULL);
+	g_token_total += (type != TOKEN_EOF);
 	token->type = type;
 	token->quoted = quoted;
 	token->next = NULL;
@@ -64,7 +74,7 @@ void	token_lstadd_back(t_token **head, t_token *new)
 
 void	token_print(t_token *token)
 {
-	const char	*type_str[8];
+	const char	*type_str[13];
 
 	type_str[TOKEN_EOF] = "EOF";
 	type_str[TOKEN_WORD] = "WORD";
@@ -74,6 +84,11 @@ void	token_print(t_token *token)
 	type_str[TOKEN_REDIR_OUT] = "REDIR_OUT";
 	type_str[TOKEN_REDIR_APPEND] = "REDIR_APPEND";
 	type_str[TOKEN_HEREDOC] = "HEREDOC";
+	type_str[TOKEN_HERESTRING] = "HERESTRING";
+	type_str[TOKEN_AND_IF] = "AND_IF";
+	type_str[TOKEN_OR_IF] = "OR_IF";
+	type_str[TOKEN_SEMI] = "SEMI";
+	type_str[TOKEN_AMP] = "AMP";
 	if (!token)
 		return ;
 	ft_printf("[%s: '%s' quoted=%d] -> ", type_str[token->type],
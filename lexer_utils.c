@@ -1,35 +1,33 @@
 #include "includes/minishell.h"
 
-int	handle_pipe(t_token **tokens, int *i)
+int	handle_pipe(t_token **tokens, char *input, int *i)
 {
-	char	*op_value;
-
-	op_value = ft_strdup("|");
-	if (!op_value)
-		return (0);
-	token_lstadd_back(tokens, token_new(TOKEN_PIPE, op_value, 0));
+	if (input[*i + 1] == '|')
+	{
+		token_lstadd_back(tokens, token_new(TOKEN_OR_IF, "||", 0));
+		(*i) += 2;
+		return (1);
+	}
+	token_lstadd_back(tokens, token_new(TOKEN_PIPE, "|", 0));
 	(*i)++;
 	return (1);
 }
 
 int	handle_less(t_token **tokens, char *input, int *i)
 {
-	char	*op_value;
-
-	if (input[*i + 1] == '<')
+	if (input[*i + 1] == '<' && input[*i + 2] == '<')
+	{
+		token_lstadd_back(tokens, token_new(TOKEN_HERESTRING, "<<<", 0));
+		(*i) += 3;
+	}
+	else if (input[*i + 1] == '<')
 	{
-		op_value = ft_strdup("<<");
-		if (!op_value)
-			return (0);
-		token_lstadd_back(tokens, token_new(TOKEN_HEREDOC, op_value, 0));
+		token_lstadd_back(tokens, token_new(TOKEN_HEREDOC, "<<", 0));
 		(*i) += 2;
 	}
 	else
 	{
-		op_value = ft_strdup("<");
-		if (!op_value)
-			return (0);
-		token_lstadd_back(tokens, token_new(TOKEN_REDIR_IN, op_value, 0));
+		token_lstadd_back(tokens, token_new(TOKEN_REDIR_IN, "<", 0));
 		(*i)++;
 	}
 	return (1);
@@ -37,22 +35,14 @@ int	handle_less(t_token **tokens, char *input, int *i)
 
 int	handle_greater(t_token **tokens, char *input, int *i)
 {
-	char	*op_value;
-
 	if (input[*i + 1] == '>')
 	{
-		op_value = ft_strdup(">>");
-		if (!op_value)
-			return (0);
-		token_lstadd_back(tokens, token_new(TOKEN_REDIR_APPEND, op_value, 0));
+		token_lstadd_back(tokens, token_new(TOKEN_REDIR_APPEND, ">>", 0));
 		(*i) += 2;
 	}
 	else
 	{
-		op_value = ft_strdup(">");
-		if (!op_value)
-			return (0);
-		token_lstadd_back(tokens, token_new(TOKEN_REDIR_OUT, op_value, 0));
+		token_lstadd_back(tokens, token_new(TOKEN_REDIR_OUT, ">", 0));
 		(*i)++;
 	}
 	return (1);
@@ -61,7 +51,11 @@ int	handle_greater(t_token **tokens, char *input, int *i)
 int	handle_operators(t_token **tokens, char *input, int *i)
 {
 	if (input[*i] == '|')
-		return (handle_pipe(tokens, i));
+		return (handle_pipe(tokens, input, i));
+	if (input[*i] == '&')
+		return (handle_amp(tokens, input, i));
+	if (input[*i] == ';')
+		return (handle_semi(tokens, i));
 	if (input[*i] == '<')
 		return (handle_less(tokens, input, i));
 	if (input[*i] == '>')
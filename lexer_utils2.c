@@ -2,7 +2,7 @@
 
 int	ft_isoperator(char c)
 {
-	return (c == '|' || c == '<' || c == '>');
+	return (c == '|' || c == '<' || c == '>' || c == '&' || c == ';');
 }
 
 void	skip_whitespace(char *input, int *i)
@@ -10,3 +10,25 @@ void	skip_whitespace(char *input, int *i)
 	while (input[*i] && ft_isspace((unsigned char)input[*i]))
 		(*i)++;
 }
+
+int	handle_amp(t_token **tokens, char *input, int *i)
+{
+	if (input[*i + 1] == '&')
+	{
+		token_lstadd_back(tokens, token_new(TOKEN_AND_IF, "&&", 0));
+		(*i) += 2;
+	}
+	else
+	{
+		token_lstadd_back(tokens, token_new(TOKEN_AMP, "&", 0));
+		(*i)++;
+	}
+	return (1);
+}
+
+int	handle_semi(t_token **tokens, int *i)
+{
+	token_lstadd_back(tokens, token_new(TOKEN_SEMI, ";", 0));
+	(*i)++;
+	return (1);
+}
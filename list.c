@@ -0,0 +1,58 @@
+#include "includes/minishell.h"
+
+/**
+ * execute_member - Expands and runs one member of a list
+ * @node: Member (a pipeline, a command, a `time` or a nested list)
+ * @shell: Shell context
+ *
+ * Expansion is done here rather than before the line starts, so each
+ * member sees $? and $! as left by the members before it.
+ *
+ * Returns: Exit status of the member
+ */
+int	execute_member(t_ast_node *node, t_shell *shell)
+{
+	int	stage;
+	int	ok;
+
+	if (is_list_node(node->type))
+		return (execute_list(node, shell));
+	stage = mem_stage(MEM_EXPANDING);
+	PROBE0(expand_start);
+	ok = expand_ast(node, shell);
+	PROBE1(expand_end, ok);
+	mem_stage(stage);
+	if (!ok)
+	{
+		ft_putstr_fd("minishell: expansion failed\n", 2);
+		return (record_status(shell, 1));
+	}
+	return (execute_ast(node, shell));
+}
+
+/**
+ * execute_list - Executes a NODE_AND, NODE_OR, NODE_LIST or NODE_BACKGROUND
+ * @ast: List node
+ * @shell: Shell context
+ *
+ * The left member always runs first; shell->exit_status is updated
+ * before the right one is considered. && only runs it after a success,
+ * || only after a failure. A background job is launched and not waited
+ * for.
+ *
+ * Returns: Exit status of the last member that ran
+ */
+int	execute_list(t_ast_node *ast, t_shell *shell)
+{
+	int	status;
+
+	if (ast->type == NODE_BACKGROUND)
+		return (launch_job(ast->left, shell));
+	status = execute_member(ast->left, shell);
+	shell->exit_status = status;
+	if (ast->type == NODE_AND && status != 0)
+		return (status);
+	if (ast->type == NODE_OR && status == 0)
+		return (status);
+	return (execute_member(ast->right, shell));
+}
@@ -3,55 +3,145 @@
 
 // loop do minishell
 // read - ft_readline
-// evaluate - parser
-// TODO
+// evaluate - lexer -> parser -> heredocs -> expander
+// execute - executor
+
+/**
+ * run_ast - Collects heredocs, expands and executes a parsed line
+ * @ast: AST of the line
+ * @shell: Shell context
+ *
+ * Heredoc collection waits on the user typing the bodies, so it is
+ * traced but left out of the shellstats stage times.
+ *
+ * Returns: Exit status of the line
+ */
+static int	run_ast(t_ast_node *ast, t_shell *shell)
+{
+	int		status;
+	long	t0;
+
+	t0 = TRACE_BEGIN(shell->trace);
+	mem_stage(MEM_PARSING);
+	status = collect_heredocs(ast, shell);
+	TRACE_END(shell->trace, "heredocs", t0);
+	if (!status)
+		return (1);
+	t0 = trace_now();
+	mem_stage(MEM_EXPANDING);
+	PROBE0(expand_start);
+	status = expand_ast(ast, shell);
+	PROBE1(expand_end, status);
+	TRACE_END(shell->trace, "expand_ast", t0);
+	stats_stage(shell, STAT_EXPAND, t0);
+	if (!status)
+	{
+		ft_putstr_fd("minishell: expansion failed\n", 2);
+		return (1);
+	}
+	t0 = trace_now();
+	mem_stage(MEM_EXECUTING);
+	status = execute_ast(ast, shell);
+	TRACE_END(shell->trace, "execute_ast", t0);
+	stats_stage(shell, STAT_EXEC, t0);
+	if (status == 128 + SIGINT)
+		write(1, "\n", 1);
+	else if (status == 128 + SIGQUIT)
+		ft_putstr_fd("Quit (core dumped)\n", 2);
+	return (status);
+}
 
 void	shell_loop(t_shell *shell, t_token *tokens)
 {
 	t_ast_node	*ast;
+	long		t0;
+	long		n;
+
 	while (1)
 	{
+		t0 = TRACE_BEGIN(shell->trace);
 		setup_signals();
+		TRACE_END(shell->trace, "setup_signals", t0);
+		jobs_notify(shell);
+		t0 = TRACE_BEGIN(shell->trace);
 		shell->line = ft_readline(">", shell);
-		printf("%s\n", shell->line);
+		TRACE_END(shell->trace, "readline", t0);
+		PROBE1(line_read, shell->line);
+		shell->stats.lines++;
+		if (shell->mem_stats)
+			mem_stats_start();
+		t0 = trace_now();
+		mem_stage(MEM_LEXING);
+		PROBE0(lexer_start);
+		n = token_total();
 		tokens = lexer(shell->line);
+		n = token_total() - n;
+		shell->stats.tokens += n;
+		PROBE1(lexer_end, n);
+		TRACE_END(shell->trace, "lexer", t0);
+		stats_stage(shell, STAT_LEX, t0);
 		if (NULL == tokens)
 		{
+			shell->exit_status = 2;
+			mem_stats_report();
 			free_shell(shell);
 			continue ;
 		}
-		token_print(tokens);
+		t0 = trace_now();
+		mem_stage(MEM_PARSING);
+		PROBE0(parse_start);
+		n = ast_node_total();
 		ast = parse(tokens);
-		ast_print(ast, 0);
-		if (ast)
+		n = ast_node_total() - n;
+		shell->stats.nodes += n;
+		PROBE1(parse_end, n);
+		TRACE_END(shell->trace, "parse", t0);
+		stats_stage(shell, STAT_PARSE, t0);
+		if (ast && TOKEN_EOF != tokens->type)
 		{
-			if (expand_ast(ast, shell)) // Expand the AST
-				ast_print(ast, 0);      // Print the expanded AST
-			else
-				ft_printf("Expansion failed\n");
-			ast_free(ast);              // Free the AST after printing
+			audit_begin(shell);
+			shell->exit_status = run_ast(ast, shell);
+			audit_record(shell, shell->line);
 		}
+		else if (!ast)
+			shell->exit_status = 2;
+		mem_stage(MEM_IDLE);
+		ast_free(ast);
 		token_lstclear(&tokens);
+		mem_stats_report();
+		free_shell(shell);
 	}
 }
 
 int	main(int ac, char **av, char **envp)
 {
 
-	(void)ac;
-	(void)av;
 	(void)envp;
 	t_shell	shell;
 	t_token tokens;
+	long	t0;
 
 	ft_memset(&shell, 0, sizeof(t_shell));
 	ft_memset(&tokens, 0, sizeof(t_token));
+	if (ac > 1 && !ft_strcmp(av[1], "--mem-stats"))
+		shell.mem_stats = 1;
+	trace_init(&shell);
+	audit_init(&shell);
+	t0 = TRACE_BEGIN(shell.trace);
 	init_shell(envp, &shell);
+	TRACE_END(shell.trace, "init_shell", t0);
 	//print envp
 	//for(int i = 0; shell.envp[i] != NULL; i++)
 	//	ft_printf("%s\n", shell.envp[i]);
 
 	shell_loop(&shell, &tokens);
-	free_array(shell.envp);
+	trace_dump(&shell);
+	audit_close(&shell);
+	jobs_clear(&shell);
+	waitset_free(&shell.children);
+	free(shell.pipestatus);
+	free(shell.readbuf.data);
+	free(shell.cwd.path);
+	env_free(&shell);
 
 }
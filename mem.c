@@ -0,0 +1,200 @@
+#include "includes/minishell.h"
+#include <malloc.h>
+
+/*
+** Every malloc/calloc/realloc/free of the shell and of libft goes
+** through the wrappers below (linked with -Wl,--wrap, see MEM_WRAP in
+** the Makefile), as do the libc calls that return memory to free():
+** strdup, strndup and getcwd(NULL, 0). The allocator has no way to reach the shell context,
+** so the counters live here; with --mem-stats off they cost one branch.
+*/
+static t_mem	g_mem;
+
+void	*__real_malloc(size_t size);
+void	*__real_calloc(size_t n, size_t size);
+void	*__real_realloc(void *ptr, size_t size);
+void	__real_free(void *ptr);
+char	*__real_strdup(const char *s);
+char	*__real_strndup(const char *s, size_t n);
+char	*__real_getcwd(char *buf, size_t size);
+
+/**
+ * mem_account - Adds an allocation (or a release) to the current stage
+ * @ptr: Block allocated or about to be freed
+ * @sign: 1 for an allocation, -1 for a release
+ *
+ * Block sizes come from malloc_usable_size(), so blocks need no header
+ * and blocks allocated before accounting started can still be freed
+ * (the live total then drops below the line's starting point).
+ */
+static void	mem_account(void *ptr, int sign)
+{
+	t_mem_stage	*s;
+	long		size;
+
+	if (!ptr)
+		return ;
+	s = &g_mem.stages[g_mem.stage];
+	size = malloc_usable_size(ptr);
+	if (sign < 0)
+	{
+		g_mem.live -= size;
+		return ;
+	}
+	s->calls++;
+	s->bytes += size;
+	g_mem.live += size;
+	if (g_mem.live - g_mem.start > s->peak)
+		s->peak = g_mem.live - g_mem.start;
+}
+
+void	*__wrap_malloc(size_t size)
+{
+	void	*ptr;
+
+	ptr = __real_malloc(size);
+	if (g_mem.on)
+		mem_account(ptr, 1);
+	return (ptr);
+}
+
+void	*__wrap_calloc(size_t n, size_t size)
+{
+	void	*ptr;
+
+	ptr = __real_calloc(n, size);
+	if (g_mem.on)
+		mem_account(ptr, 1);
+	return (ptr);
+}
+
+void	*__wrap_realloc(void *ptr, size_t size)
+{
+	if (g_mem.on)
+		mem_account(ptr, -1);
+	ptr = __real_realloc(ptr, size);
+	if (g_mem.on)
+		mem_account(ptr, 1);
+	return (ptr);
+}
+
+void	__wrap_free(void *ptr)
+{
+	if (g_mem.on)
+		mem_account(ptr, -1);
+	__real_free(ptr);
+}
+
+char	*__wrap_strdup(const char *s)
+{
+	char	*ptr;
+
+	ptr = __real_strdup(s);
+	if (g_mem.on)
+		mem_account(ptr, 1);
+	return (ptr);
+}
+
+char	*__wrap_strndup(const char *s, size_t n)
+{
+	char	*ptr;
+
+	ptr = __real_strndup(s, n);
+	if (g_mem.on)
+		mem_account(ptr, 1);
+	return (ptr);
+}
+
+char	*__wrap_getcwd(char *buf, size_t size)
+{
+	char	*ptr;
+
+	ptr = __real_getcwd(buf, size);
+	if (g_mem.on && !buf)
+		mem_account(ptr, 1);
+	return (ptr);
+}
+
+/**
+ * mem_stage - Attributes the following allocations to a stage
+ * @stage: MEM_LEXING, MEM_PARSING, MEM_EXPANDING, MEM_EXECUTING or
+ * MEM_IDLE
+ *
+ * Returns: The previous stage, for callers that nest (lazy expansion
+ * inside execute_list())
+ */
+int	mem_stage(int stage)
+{
+	int	prev;
+
+	prev = g_mem.stage;
+	g_mem.stage = stage;
+	return (prev);
+}
+
+/**
+ * mem_stats_start - Turns accounting on for a new line
+ *
+ * Called after readline(), whose allocations are not wrapped. Counters
+ * restart at zero; the live total is kept, so a line that leaks shows
+ * up as retained bytes in its report.
+ */
+void	mem_stats_start(void)
+{
+	ft_memset(g_mem.stages, 0, sizeof(g_mem.stages));
+	g_mem.start = g_mem.live;
+	g_mem.stage = MEM_IDLE;
+	g_mem.on = 1;
+}
+
+/**
+ * mem_live - Returns the bytes allocated and not freed since accounting
+ * started (including blocks freed then that were allocated before)
+ */
+long	mem_live(void)
+{
+	return (g_mem.live);
+}
+
+/**
+ * mem_stats_report - Prints the allocations of the line and stops counting
+ *
+ * One line on stderr, e.g.
+ * "mem: lex 4/96B/96B parse 9/336B/432B expand 0/0B/0B exec 2/48B/480B
+ * retained 0B", where each stage shows allocations, bytes allocated and
+ * peak live bytes above the start of the line. Allocations made outside
+ * every stage are only listed when there are some. Does nothing when
+ * accounting is off, so the shell loop calls it unconditionally.
+ */
+void	mem_stats_report(void)
+{
+	static const char	*names[MEM_STAGES] = {"other", "lex", "parse",
+		"expand", "exec"};
+	t_outbuf			ob;
+	int					i;
+
+	if (!g_mem.on)
+		return ;
+	g_mem.on = 0;
+	outbuf_init(&ob, 2);
+	outbuf_puts(&ob, "mem:");
+	i = -1;
+	while (++i < MEM_STAGES)
+	{
+		if (i == MEM_IDLE && !g_mem.stages[i].calls)
+			continue ;
+		outbuf_putc(&ob, ' ');
+		outbuf_puts(&ob, names[i]);
+		outbuf_putc(&ob, ' ');
+		outbuf_putnum(&ob, g_mem.stages[i].calls);
+		outbuf_putc(&ob, '/');
+		outbuf_putnum(&ob, g_mem.stages[i].bytes);
+		outbuf_puts(&ob, "B/");
+		outbuf_putnum(&ob, g_mem.stages[i].peak);
+		outbuf_putc(&ob, 'B');
+	}
+	outbuf_puts(&ob, " retained ");
+	outbuf_putnum(&ob, g_mem.live - g_mem.start);
+	outbuf_puts(&ob, "B\n");
+	outbuf_flush(&ob);
+}
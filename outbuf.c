@@ -0,0 +1,115 @@
+#include "includes/minishell.h"
+
+/**
+ * outbuf_init - Prepares an empty output buffer
+ * @ob: Buffer to initialize (usually on the builtin's stack)
+ * @fd: Descriptor the buffer is flushed to
+ */
+void	outbuf_init(t_outbuf *ob, int fd)
+{
+	ob->fd = fd;
+	ob->len = 0;
+	ob->error = 0;
+}
+
+/**
+ * outbuf_flush - Writes the buffered bytes out
+ * @ob: Output buffer
+ *
+ * Short writes are retried; after an error the rest of the output is
+ * dropped and only reported once, by the caller.
+ *
+ * Returns: 1 on success, 0 if any write of this buffer failed
+ */
+int	outbuf_flush(t_outbuf *ob)
+{
+	size_t	done;
+	ssize_t	n;
+
+	done = 0;
+	while (!ob->error && done < ob->len)
+	{
+		n = write(ob->fd, ob->buf + done, ob->len - done);
+		if (n == -1 && errno != EINTR)
+			ob->error = errno;
+		else if (n > 0)
+			done += n;
+	}
+	ob->len = 0;
+	return (!ob->error);
+}
+
+/**
+ * outbuf_write - Appends bytes to the buffer
+ * @ob: Output buffer
+ * @data: Bytes to append
+ * @len: Number of bytes
+ *
+ * The buffer is flushed whenever it fills, so a builtin costs one
+ * write() per OUTBUF_SIZE bytes of output plus the final flush.
+ */
+void	outbuf_write(t_outbuf *ob, const char *data, size_t len)
+{
+	size_t	room;
+
+	while (len > 0)
+	{
+		if (ob->len == OUTBUF_SIZE)
+			outbuf_flush(ob);
+		room = OUTBUF_SIZE - ob->len;
+		if (room > len)
+			room = len;
+		ft_memcpy(ob->buf + ob->len, data, room);
+		ob->len += room;
+		data += room;
+		len -= room;
+	}
+}
+
+/**
+ * outbuf_putc - Appends one byte to the buffer
+ * @ob: Output buffer
+ * @c: Byte to append
+ */
+void	outbuf_putc(t_outbuf *ob, char c)
+{
+	if (ob->len == OUTBUF_SIZE)
+		outbuf_flush(ob);
+	ob->buf[ob->len++] = c;
+}
+
+/**
+ * outbuf_puts - Appends a string to the buffer
+ * @ob: Output buffer
+ * @s: NUL-terminated string
+ */
+void	outbuf_puts(t_outbuf *ob, const char *s)
+{
+	outbuf_write(ob, s, ft_strlen(s));
+}
+
+/**
+ * outbuf_putnum - Appends a signed decimal number
+ * @ob: Output buffer
+ * @n: Number
+ */
+void	outbuf_putnum(t_outbuf *ob, long n)
+{
+	char			buf[24];
+	int				i;
+	unsigned long	u;
+
+	u = n;
+	if (n < 0)
+		u = -(unsigned long)n;
+	i = sizeof(buf);
+	buf[--i] = '0' + u % 10;
+	while (u >= 10)
+	{
+		u /= 10;
+		buf[--i] = '0' + u % 10;
+	}
+	if (n < 0)
+		buf[--i] = '-';
+	outbuf_write(ob, buf + i, sizeof(buf) - i);
+}
@@ -4,6 +4,21 @@
 /*                         NODE CREATION FUNCTIONS                            */
 /* ************************************************************************** */
 
+static long	g_ast_node_total;
+
+/**
+ * ast_node_total - Counts the AST nodes created so far
+ *
+ * Redirection nodes are not included. shellstats takes the difference
+ * around parse() instead of walking every tree.
+ *
+ * Returns: Nodes created since the shell started
+ */
+long	ast_node_total(void)
+{
+	return (g_ast_node_total);
+}
+
 /**
  * ast_new_node - Creates a new AST node
  * @type: The type of node (NODE_COMMAND, NODE_PIPE, etc.)
@@ -19,6 +34,7 @@ t_ast_node	*ast_new_node(t_node_type type)
 	node = (t_ast_node *)malloc(sizeof(t_ast_node));
 	if (!node)
 		return (NULL);
+	g_ast_node_total++;
 	node->type = type;
 	node->args = NULL;
 	node->args_quoted = NULL;
@@ -48,6 +64,7 @@ t_redir_node *redir_new_node(t_node_type type, char *file, int quoted)
     node->type = type;
     node->file = ft_strdup(file);
     node->quoted = quoted;  // 🆕 Store quote info
+    node->fd = -1;
     if (!node->file)
     {
         free(node);
@@ -97,6 +114,8 @@ void	redir_free(t_redir_node *redir)
 		tmp = redir->next;
 		if (redir->file)
 			free(redir->file);
+		if (redir->fd != -1)
+			close(redir->fd);
 		free(redir);
 		redir = tmp;
 	}
@@ -114,6 +133,8 @@ void	redir_lstclear(t_redir_node **head)
 	{
 		next = current->next;
 		free(current->file);
+		if (current->fd != -1)
+			close(current->fd);
 		free(current);
 		current = next;
 	}
@@ -332,6 +353,18 @@ void print_node_type(t_node_type type)
         ft_printf("REDIR_APPEND");
     else if (type == NODE_HEREDOC)
         ft_printf("HEREDOC");
+    else if (type == NODE_HERESTRING)
+        ft_printf("HERESTRING");
+    else if (type == NODE_AND)
+        ft_printf("AND");
+    else if (type == NODE_OR)
+        ft_printf("OR");
+    else if (type == NODE_LIST)
+        ft_printf("LIST");
+    else if (type == NODE_BACKGROUND)
+        ft_printf("BACKGROUND");
+    else if (type == NODE_TIME)
+        ft_printf("TIME");
     else
         ft_printf("UNKNOWN");
 }
@@ -415,7 +448,13 @@ void ast_print(t_ast_node *node, int depth)
         }
         print_redirects(node->redirects, depth + 1);
     }
-    else if (node->type == NODE_PIPE)
+    else if (node->type == NODE_TIME)
+    {
+        print_indent(depth + 1);
+        ft_printf("Options: %d\n", args_count(node->args));
+        ast_print(node->left, depth + 1);
+    }
+    else if (node->type == NODE_PIPE || is_list_node(node->type))
     {
         print_indent(depth + 1);
         ft_printf("Left:\n");
@@ -439,7 +478,8 @@ void ast_print(t_ast_node *node, int depth)
 int	is_redir_type(t_node_type type)
 {
 	return (type == NODE_REDIR_IN || type == NODE_REDIR_OUT
-		|| type == NODE_REDIR_APPEND || type == NODE_HEREDOC);
+		|| type == NODE_REDIR_APPEND || type == NODE_HEREDOC
+		|| type == NODE_HERESTRING);
 }
 
 /**
@@ -451,7 +491,48 @@ int	is_redir_type(t_node_type type)
 int	is_redir_token(t_token_type type)
 {
 	return (type == TOKEN_REDIR_IN || type == TOKEN_REDIR_OUT
-		|| type == TOKEN_REDIR_APPEND || type == TOKEN_HEREDOC);
+		|| type == TOKEN_REDIR_APPEND || type == TOKEN_HEREDOC
+		|| type == TOKEN_HERESTRING);
+}
+
+/**
+ * is_control_token - Checks if a token type ends a command
+ * @type: Token type to check
+ *
+ * Control operators are '|' and the list operators '&&', '||', ';', '&'.
+ *
+ * Returns: 1 if token is a control operator, 0 otherwise
+ */
+int	is_control_token(t_token_type type)
+{
+	return (type == TOKEN_PIPE || type == TOKEN_AND_IF
+		|| type == TOKEN_OR_IF || type == TOKEN_SEMI || type == TOKEN_AMP);
+}
+
+/**
+ * is_list_node - Checks if a node type joins pipelines into a list
+ * @type: Node type to check
+ *
+ * Returns: 1 for NODE_AND, NODE_OR, NODE_LIST and NODE_BACKGROUND
+ */
+int	is_list_node(t_node_type type)
+{
+	return (type == NODE_AND || type == NODE_OR
+		|| type == NODE_LIST || type == NODE_BACKGROUND);
+}
+
+/**
+ * is_time_keyword - Checks if a token starts a timed pipeline
+ * @token: Token to check, or NULL
+ *
+ * Like in bash, `time` is only a keyword when it is not quoted.
+ *
+ * Returns: 1 for the unquoted word "time"
+ */
+int	is_time_keyword(t_token *token)
+{
+	return (token && token->type == TOKEN_WORD && !token->quoted
+		&& !ft_strcmp(token->value, "time"));
 }
 
 /**
@@ -472,6 +553,8 @@ t_node_type	token_to_node_type(t_token_type token_type)
 		return (NODE_REDIR_APPEND);
 	if (token_type == TOKEN_HEREDOC)
 		return (NODE_HEREDOC);
+	if (token_type == TOKEN_HERESTRING)
+		return (NODE_HERESTRING);
 	return (NODE_COMMAND);
 }
 
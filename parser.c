@@ -60,6 +60,8 @@ t_ast_node	*parse_pipeline(t_parser *parser)
 	t_ast_node	*left;
 	t_ast_node	*right;
 
+	if (is_time_keyword(parser->current))
+		return (parse_time(parser));
 	left = parse_command(parser);
 	if (!left)
 		return (NULL);
@@ -79,6 +81,138 @@ t_ast_node	*parse_pipeline(t_parser *parser)
 	return (left);
 }
 
+/**
+ * parse_time - Parses a pipeline prefixed by the `time` keyword
+ * @parser: Parser context (current token is the unquoted word "time")
+ *
+ * Words starting with '-' right after the keyword are its options and
+ * stay in the node's args; they are checked when the node runs. The
+ * pipeline may be missing ("time" alone reports an empty run).
+ *
+ * Example: "time -s cat in | wc -l"
+ * Result:      TIME (args=["-s"])
+ *               |
+ *              PIPE
+ *             /    \
+ *        cat in   wc -l
+ *
+ * Returns: NODE_TIME node, or NULL on failure
+ */
+t_ast_node	*parse_time(t_parser *parser)
+{
+	t_ast_node	*node;
+	char		**args;
+
+	node = ast_new_node(NODE_TIME);
+	if (!node)
+		return (NULL);
+	next_token(parser);
+	while (parser->current && parser->current->type == TOKEN_WORD
+		&& !parser->current->quoted && parser->current->value[0] == '-'
+		&& parser->current->value[1])
+	{
+		args = args_add(node->args, &node->args_quoted,
+				parser->current->value, 0);
+		if (!args)
+			return (ast_free(node), NULL);
+		node->args = args;
+		next_token(parser);
+	}
+	if (match_token(parser, TOKEN_PIPE))
+		parser_error(parser, "syntax error near unexpected token `|'");
+	if (is_command_end(parser))
+		return (node);
+	node->left = parse_pipeline(parser);
+	if (!node->left)
+		return (ast_free(node), NULL);
+	return (node);
+}
+
+/**
+ * parse_and_or - Parses pipelines joined by && and ||
+ * @parser: Parser context
+ *
+ * Both operators have the same precedence and associate to the left:
+ * "a && b || c" becomes "((a && b) || c)", so c runs if a or b failed.
+ *
+ * Returns: AST node representing the and-or list, or NULL on failure
+ */
+t_ast_node	*parse_and_or(t_parser *parser)
+{
+	t_ast_node	*left;
+	t_ast_node	*right;
+	t_node_type	type;
+
+	left = parse_pipeline(parser);
+	if (!left)
+		return (NULL);
+	while (match_token(parser, TOKEN_AND_IF)
+		|| match_token(parser, TOKEN_OR_IF))
+	{
+		type = NODE_OR;
+		if (match_token(parser, TOKEN_AND_IF))
+			type = NODE_AND;
+		next_token(parser);
+		right = parse_pipeline(parser);
+		if (!right)
+		{
+			ast_free(left);
+			return (NULL);
+		}
+		left = create_list_node(type, left, right);
+		if (!left)
+			return (NULL);
+	}
+	return (left);
+}
+
+/**
+ * parse_list - Parses and-or lists separated by ; and &
+ * @parser: Parser context
+ *
+ * An and-or list followed by '&' is wrapped in a NODE_BACKGROUND node
+ * (only that one: in "a ; b &" a still runs in the foreground). Lists
+ * chain to the left like pipelines, and a trailing ';' or '&' is allowed.
+ *
+ * Example: "make a & make b & wait"
+ * Result:           LIST
+ *                  /    \
+ *              LIST      wait
+ *             /    \
+ *      BACKGROUND  BACKGROUND
+ *          |           |
+ *       make a      make b
+ *
+ * Returns: AST node representing the whole line, or NULL on failure
+ */
+t_ast_node	*parse_list(t_parser *parser)
+{
+	t_ast_node	*left;
+	t_ast_node	*item;
+
+	left = NULL;
+	while (1)
+	{
+		item = parse_and_or(parser);
+		if (!item)
+			return (ast_free(left), NULL);
+		if (match_token(parser, TOKEN_AMP))
+			item = create_list_node(NODE_BACKGROUND, item, NULL);
+		if (item && left)
+			item = create_list_node(NODE_LIST, left, item);
+		else if (!item)
+			ast_free(left);
+		left = item;
+		if (!left || !(match_token(parser, TOKEN_SEMI)
+				|| match_token(parser, TOKEN_AMP)))
+			break ;
+		next_token(parser);
+		if (match_token(parser, TOKEN_EOF))
+			break ;
+	}
+	return (left);
+}
+
 /**
  * print_parser_error - Prints parser error message to stderr
  * @parser: Parser context with error information
@@ -122,13 +256,14 @@ void	parser_init(t_parser *parser, t_token *tokens)
  * Process:
  * 1. Validate syntax (check for basic errors)
  * 2. Initialize parser context
- * 3. Parse the pipeline (builds AST)
+ * 3. Parse the list (builds AST)
  * 4. Check for parser errors
  * 5. Return AST or NULL on error
  * 
  * The returned AST represents the structure of the command line:
  * - Simple command: NODE_COMMAND with args and redirects
  * - Pipeline: NODE_PIPE with left and right children
+ * - Lists: NODE_AND, NODE_OR, NODE_LIST and NODE_BACKGROUND
  * 
  * Example input: "cat < in | grep test > out"
  * Example output:
@@ -148,7 +283,7 @@ t_ast_node	*parse(t_token *tokens)
 	if (!validate_syntax(tokens))
 		return (NULL);
 	parser_init(&parser, tokens);
-	ast = parse_pipeline(&parser);
+	ast = parse_list(&parser);
 	if (parser.error)
 	{
 		print_parser_error(&parser);
@@ -10,7 +10,8 @@ int	validate_redirects(t_token *tokens)
 		if (is_redir_token(current->type))
 		{
 			current = current->next;
-			if (TOKEN_EOF == current->type || TOKEN_PIPE == current->type
+			if (TOKEN_EOF == current->type
+				|| is_control_token(current->type)
 				|| is_redir_token(current->type))
 			{
 				ft_putstr_fd
@@ -52,6 +53,51 @@ int	validate_pipes(t_token *tokens)
 	return (1);
 }
 
+/**
+ * list_error - Reports an unexpected token around a list operator
+ * @token: Offending token
+ *
+ * Returns: 0
+ */
+static int	list_error(t_token *token)
+{
+	ft_putstr_fd("minishell: syntax error near unexpected token `", 2);
+	if (TOKEN_EOF == token->type)
+		ft_putstr_fd("newline", 2);
+	else
+		ft_putstr_fd(token->value, 2);
+	ft_putstr_fd("'\n", 2);
+	return (0);
+}
+
+/**
+ * validate_lists - Checks the placement of &&, ||, ; and &
+ * @tokens: Token list
+ *
+ * A list operator needs a command on its left, and cannot be followed
+ * by another control operator. Only ';' and '&' may end the line.
+ *
+ * Returns: 1 if valid, 0 after printing the error
+ */
+int	validate_lists(t_token *tokens)
+{
+	t_token	*current;
+
+	current = tokens;
+	if (is_control_token(current->type))
+		return (list_error(current));
+	while (current && current->type != TOKEN_EOF)
+	{
+		if ((is_control_token(current->type)
+				&& is_control_token(current->next->type))
+			|| ((TOKEN_AND_IF == current->type || TOKEN_OR_IF == current->type)
+				&& TOKEN_EOF == current->next->type))
+			return (list_error(current->next));
+		current = current->next;
+	}
+	return (1);
+}
+
 int	validate_syntax(t_token *tokens)
 {
 	if (!tokens)
@@ -60,6 +106,8 @@ int	validate_syntax(t_token *tokens)
 		return (1);
 	if (!validate_pipes(tokens))
 		return (0);
+	if (!validate_lists(tokens))
+		return (0);
 	if (!validate_redirects(tokens))
 		return (0);
 	return (1);
@@ -86,7 +86,7 @@ int handle_argument(t_parser *parser, t_ast_node *cmd)
  * 
  * A command ends when we encounter:
  * - NULL (end of token list)
- * - TOKEN_PIPE (command separator)
+ * - A control operator: |, &&, ||, ; or &
  * - TOKEN_EOF (end of input)
  * 
  * Returns: 1 if at end, 0 otherwise
@@ -95,7 +95,7 @@ int	is_command_end(t_parser *parser)
 {
 	if (!parser->current)
 		return (1);
-	if (parser->current->type == TOKEN_PIPE)
+	if (is_control_token(parser->current->type))
 		return (1);
 	if (parser->current->type == TOKEN_EOF)
 		return (1);
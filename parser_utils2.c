@@ -87,3 +87,30 @@ t_ast_node	*create_pipe_node(t_ast_node *left, t_ast_node *right)
 	pipe_node->right = right;
 	return (pipe_node);
 }
+
+/**
+ * create_list_node - Creates a list node linking two and-or lists
+ * @type: NODE_AND, NODE_OR, NODE_LIST or NODE_BACKGROUND
+ * @left: Left side (the job itself for NODE_BACKGROUND)
+ * @right: Right side, or NULL
+ *
+ * If allocation fails, frees both children to prevent memory leaks.
+ *
+ * Returns: List node, or NULL on failure
+ */
+t_ast_node	*create_list_node(t_node_type type, t_ast_node *left,
+		t_ast_node *right)
+{
+	t_ast_node	*node;
+
+	node = ast_new_node(type);
+	if (!node)
+	{
+		ast_free(left);
+		ast_free(right);
+		return (NULL);
+	}
+	node->left = left;
+	node->right = right;
+	return (node);
+}
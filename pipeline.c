@@ -0,0 +1,184 @@
+#define _GNU_SOURCE
+#include "includes/minishell.h"
+
+/**
+ * pipeline_commands - Flattens a pipeline into its list of commands
+ * @ast: Root of the pipeline (left-associative NODE_PIPE tree)
+ * @count: Output parameter for the number of commands
+ *
+ * parse_pipeline() builds "a | b | c" as ((a | b) | c), so the commands
+ * are collected from the right while walking down the left spine. No
+ * recursion: a pipeline with thousands of stages is only a long spine.
+ *
+ * Returns: Allocated array of command nodes in pipeline order, or NULL
+ */
+static t_ast_node	**pipeline_commands(t_ast_node *ast, int *count)
+{
+	t_ast_node	**cmds;
+	t_ast_node	*node;
+	int			i;
+
+	*count = 1;
+	node = ast;
+	while (node->type == NODE_PIPE)
+	{
+		(*count)++;
+		node = node->left;
+	}
+	cmds = malloc(sizeof(t_ast_node *) * (*count));
+	if (!cmds)
+		return (NULL);
+	i = *count;
+	node = ast;
+	while (node->type == NODE_PIPE)
+	{
+		cmds[--i] = node->right;
+		node = node->left;
+	}
+	cmds[0] = node;
+	return (cmds);
+}
+
+/**
+ * stage_child - Body of one pipeline stage after fork()
+ * @cmd: Command of the stage
+ * @in: Read end of the previous pipe, or -1 for the first stage
+ * @out: Write end of the next pipe, or -1 for the last stage
+ * @shell: Shell context
+ *
+ * The pipe ends become stdin/stdout, then the stage's own redirections
+ * are opened and applied on top of them. redirect_child() drops every
+ * other descriptor with one close_range(). Never returns.
+ */
+static void	stage_child(t_ast_node *cmd, int in, int out, t_shell *shell)
+{
+	t_redir_plan	plan;
+
+	if ((in != -1 && dup2(in, STDIN_FILENO) == -1)
+		|| (out != -1 && dup2(out, STDOUT_FILENO) == -1))
+		_exit(1);
+	if (!redirect_open(cmd->redirects, &plan) || !redirect_child(&plan))
+		_exit(1);
+	if (!cmd->args || !cmd->args[0])
+		_exit(0);
+	if (is_builtin(cmd->args[0]))
+		exit(exec_builtin(cmd, shell));
+	exec_command(cmd->args, shell);
+}
+
+/**
+ * launch_stage - Creates the next pipe and forks one stage
+ * @cmd: Command of the stage
+ * @prev: Read end left over from the previous stage (-1 if first)
+ * @flags: STAGE_LAST for the last stage, STAGE_ASYNC for background jobs
+ * @shell: Shell context
+ *
+ * The pipe towards the next stage is only created now, and the parent
+ * closes its copies of everything the child took as soon as fork()
+ * returns. Whatever the length of the pipeline, the parent never holds
+ * more than one pipe plus the read end it hands to the next stage.
+ *
+ * Returns: Pid of the stage (or -1), *prev receives the new read end
+ */
+static pid_t	launch_stage(t_ast_node *cmd, int *prev, int flags,
+		t_shell *shell)
+{
+	int		fds[2];
+	pid_t	pid;
+
+	fds[0] = -1;
+	fds[1] = -1;
+	if (!(flags & STAGE_LAST) && pipe2(fds, O_CLOEXEC) == -1)
+		perror("minishell: pipe");
+	pid = -1;
+	if ((flags & STAGE_LAST) || fds[0] != -1)
+		pid = control_fork();
+	if (pid == 0)
+	{
+		reset_child_signals();
+		if (flags & STAGE_ASYNC)
+			async_child(*prev == -1);
+		stage_child(cmd, *prev, fds[1], shell);
+	}
+	if (*prev != -1)
+		close(*prev);
+	if (fds[1] != -1)
+		close(fds[1]);
+	*prev = fds[0];
+	if (pid == -1 && fds[0] != -1)
+	{
+		close(fds[0]);
+		*prev = -1;
+	}
+	return (pid);
+}
+
+/**
+ * launch_pipeline - Spawns every stage of a pipeline
+ * @ast: Root of the pipeline (a single command is a one-stage pipeline)
+ * @shell: Shell context
+ * @job: Receives the wait-set slots of the stages that were launched
+ * @async: 1 for a background job
+ *
+ * Stages are spawned in a single loop over the command list and handed
+ * to the wait set; nothing is waited for here. If a pipe or fork fails,
+ * launching stops and job->n only counts the stages already running.
+ *
+ * Returns: 1 if every stage was launched, 0 otherwise
+ */
+int	launch_pipeline(t_ast_node *ast, t_shell *shell, t_job *job, int async)
+{
+	t_ast_node	**cmds;
+	int			count;
+	int			prev;
+	pid_t		pid;
+
+	job->n = 0;
+	job->pid = 0;
+	cmds = pipeline_commands(ast, &count);
+	job->slots = malloc(sizeof(int) * count);
+	if (!cmds || !job->slots || !waitset_reserve(&shell->children, count))
+		return (free(cmds), 0);
+	prev = -1;
+	while (job->n < count)
+	{
+		pid = launch_stage(cmds[job->n], &prev,
+				(job->n == count - 1) * STAGE_LAST + async * STAGE_ASYNC,
+				shell);
+		if (pid == -1)
+			break ;
+		job->pid = pid;
+		job->slots[job->n++] = waitset_add(&shell->children, pid);
+		shell->stats.forks++;
+	}
+	free(cmds);
+	return (job->n == count);
+}
+
+/**
+ * execute_pipeline - Runs every stage of a pipeline concurrently
+ * @ast: Root of the pipeline
+ * @shell: Shell context
+ *
+ * The wait set reaps the stages in whatever order they exit. Stages
+ * already running when launching failed are still waited for.
+ *
+ * Returns: Exit status of the last stage, 1 if it was never launched
+ */
+int	execute_pipeline(t_ast_node *ast, t_shell *shell)
+{
+	t_job	job;
+	int		complete;
+	int		status;
+
+	setup_exec_signals();
+	complete = launch_pipeline(ast, shell, &job, 0);
+	waitset_wait(&shell->children, job.slots, job.n, -1);
+	status = 1;
+	if (job.n > 0)
+		status = set_pipestatus(shell, job.slots, job.n);
+	free(job.slots);
+	if (!complete)
+		return (record_status(shell, 1));
+	return (status);
+}
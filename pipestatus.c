@@ -0,0 +1,95 @@
+#include "includes/minishell.h"
+
+/**
+ * set_pipestatus - Records the statuses of a finished foreground job
+ * @shell: Shell context
+ * @slots: Wait-set slots of the stages, in pipeline order (all reaped)
+ * @n: Number of stages
+ *
+ * The statuses are copied into shell->pipestatus and the slots are
+ * given back to the wait set. Inside `time` the stages are recorded
+ * first, while their rusage is still in the slots.
+ *
+ * Returns: Status of the last stage
+ */
+int	set_pipestatus(t_shell *shell, int *slots, int n)
+{
+	int	*statuses;
+	int	last;
+	int	i;
+
+	if (shell->timing)
+		timing_record(shell->timing, &shell->children, slots, n);
+	statuses = malloc(sizeof(int) * n);
+	last = shell->children.slots[slots[n - 1]].status;
+	i = 0;
+	while (i < n)
+	{
+		if (statuses)
+			statuses[i] = shell->children.slots[slots[i]].status;
+		waitset_release(&shell->children, slots[i]);
+		i++;
+	}
+	free(shell->pipestatus);
+	shell->pipestatus = statuses;
+	shell->pipestatus_len = 0;
+	if (statuses)
+		shell->pipestatus_len = n;
+	return (last);
+}
+
+/**
+ * pipestatus_string - Expansion of $PIPESTATUS
+ * @shell: Shell context
+ *
+ * Minishell has no arrays, so the statuses of every stage of the last
+ * foreground pipeline are joined with spaces ("0 1 0").
+ *
+ * Returns: Allocated string, or NULL on error
+ */
+char	*pipestatus_string(t_shell *shell)
+{
+	char	*result;
+	char	*num;
+	char	*tmp;
+	int		i;
+
+	result = ft_strdup("");
+	i = 0;
+	while (result && i < shell->pipestatus_len)
+	{
+		num = ft_itoa(shell->pipestatus[i]);
+		if (!num)
+			return (free(result), NULL);
+		tmp = result;
+		if (i > 0)
+			tmp = ft_charjoin(result, ' ');
+		result = NULL;
+		if (tmp)
+			result = ft_strjoin(tmp, num);
+		free(tmp);
+		free(num);
+		i++;
+	}
+	return (result);
+}
+
+/**
+ * record_status - Records the status of a command that did not fork
+ * @shell: Shell context
+ * @status: Exit status of the command
+ *
+ * Returns: status
+ */
+int	record_status(t_shell *shell, int status)
+{
+	int	*statuses;
+
+	statuses = malloc(sizeof(int));
+	if (statuses)
+		*statuses = status;
+	free(shell->pipestatus);
+	shell->pipestatus = statuses;
+	shell->pipestatus_len = (statuses != NULL);
+	return (status);
+}
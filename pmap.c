@@ -0,0 +1,289 @@
+#define _GNU_SOURCE
+#include "includes/minishell.h"
+#include <sys/mman.h>
+
+/**
+ * pmap_subst - Replaces every {} of a template word with the item
+ * @word: Template word
+ * @item: Item of the current run
+ * @used: Set to 1 if the word contained {}
+ *
+ * Returns: Allocated word, or NULL on error
+ */
+static char	*pmap_subst(char *word, char *item, int *used)
+{
+	char	*result;
+	char	*tmp;
+	int		i;
+
+	result = ft_strdup("");
+	i = 0;
+	while (result && word[i])
+	{
+		if (word[i] == '{' && word[i + 1] == '}')
+		{
+			tmp = ft_strjoin(result, item);
+			free(result);
+			result = tmp;
+			*used = 1;
+			i += 2;
+		}
+		else
+			result = ft_charjoin(result, word[i++]);
+	}
+	return (result);
+}
+
+/**
+ * pmap_child - Body of one run after fork()
+ * @p: pmap state
+ * @i: Index of the item
+ * @shell: Shell context
+ *
+ * The command node is the template with {} replaced by the item (the
+ * item is appended when the template has no {}), so a run costs one
+ * substitution pass and no parsing. Stdout goes to the item's memfd when
+ * the output order is kept. Never returns.
+ */
+static void	pmap_child(t_pmap *p, int i, t_shell *shell)
+{
+	t_ast_node		node;
+	t_redir_plan	plan;
+	int				used;
+	int				j;
+
+	reset_child_signals();
+	ft_memset(&node, 0, sizeof(t_ast_node));
+	node.type = NODE_COMMAND;
+	node.args = malloc(sizeof(char *) * (p->tmpl_len + 2));
+	if (!node.args)
+		_exit(1);
+	used = 0;
+	j = -1;
+	while (++j < p->tmpl_len)
+		node.args[j] = pmap_subst(p->tmpl[j], p->items[i], &used);
+	node.args[j] = NULL;
+	if (!used)
+		node.args[j++] = p->items[i];
+	node.args[j] = NULL;
+	ft_memset(&plan, -1, sizeof(t_redir_plan));
+	plan.out = p->outputs[i];
+	if (!redirect_child(&plan))
+		_exit(1);
+	if (is_builtin(node.args[0]))
+		exit(exec_builtin(&node, shell));
+	exec_command(node.args, shell);
+}
+
+/**
+ * pmap_launch - Starts the run of the next item
+ * @p: pmap state
+ * @shell: Shell context
+ *
+ * Returns: 1 if the child was forked, 0 otherwise
+ */
+static int	pmap_launch(t_pmap *p, t_shell *shell)
+{
+	pid_t	pid;
+	int		i;
+
+	i = p->next;
+	if (p->keep_order)
+	{
+		p->outputs[i] = memfd_create("minishell-pmap", MFD_CLOEXEC);
+		if (p->outputs[i] == -1)
+			return (perror("minishell: pmap"), 0);
+	}
+	pid = control_fork();
+	if (pid == 0)
+		pmap_child(p, i, shell);
+	if (pid == -1 && p->outputs[i] != -1)
+		close(p->outputs[i]);
+	if (pid == -1)
+		return (p->outputs[i] = -1, 0);
+	p->slots[i] = waitset_add(&shell->children, pid);
+	shell->stats.forks++;
+	p->next++;
+	p->running++;
+	return (1);
+}
+
+/**
+ * pmap_collect - Records the items whose run has ended
+ * @p: pmap state
+ * @shell: Shell context
+ *
+ * With keep_order, outputs are printed as soon as every item before
+ * them is done, so memory only holds the runs that finished early.
+ */
+static void	pmap_collect(t_pmap *p, t_shell *shell)
+{
+	char	buf[4096];
+	ssize_t	n;
+	int		i;
+
+	i = -1;
+	while (++i < p->next)
+	{
+		if (p->status[i] != -1
+			|| shell->children.slots[p->slots[i]].status == -1)
+			continue ;
+		p->status[i] = shell->children.slots[p->slots[i]].status;
+		waitset_release(&shell->children, p->slots[i]);
+		p->running--;
+	}
+	while (p->printed < p->next && p->status[p->printed] != -1)
+	{
+		i = p->printed++;
+		if (p->outputs[i] == -1)
+			continue ;
+		lseek(p->outputs[i], 0, SEEK_SET);
+		n = read(p->outputs[i], buf, sizeof(buf));
+		while (n > 0 && write(STDOUT_FILENO, buf, n) == n)
+			n = read(p->outputs[i], buf, sizeof(buf));
+		close(p->outputs[i]);
+		p->outputs[i] = -1;
+	}
+}
+
+/**
+ * pmap_wait_one - Blocks until one of the running items ends
+ * @p: pmap state
+ * @shell: Shell context
+ *
+ * Returns: 1, or 0 if the wait was interrupted by a signal
+ */
+static int	pmap_wait_one(t_pmap *p, t_shell *shell)
+{
+	int	*running;
+	int	n;
+	int	i;
+	int	ret;
+
+	running = malloc(sizeof(int) * p->running);
+	if (!running)
+		return (waitset_reap(&shell->children, p->slots[p->printed], 0), 1);
+	n = 0;
+	i = p->printed;
+	while (i < p->next)
+	{
+		if (p->status[i] == -1)
+			running[n++] = p->slots[i];
+		i++;
+	}
+	ret = waitset_wait_any(&shell->children, running, n);
+	free(running);
+	return (ret != -1);
+}
+
+/**
+ * pmap_run - Runs the template once per item with a bounded pool
+ * @p: pmap state (template, items, jobs and keep_order filled in)
+ * @shell: Shell context
+ *
+ * At most p->jobs children are alive at any time; a new item is launched
+ * as soon as one ends, in whatever order they end. Ctrl-C stops the
+ * launching and the runs already started are still reaped.
+ *
+ * Returns: 0 if every run succeeded, 123 if one failed (like xargs),
+ * 130 if interrupted
+ */
+int	pmap_run(t_pmap *p, t_shell *shell)
+{
+	int	i;
+
+	p->slots = malloc(sizeof(int) * p->count);
+	p->outputs = malloc(sizeof(int) * p->count);
+	p->status = malloc(sizeof(int) * p->count);
+	if (!p->slots || !p->outputs || !p->status
+		|| !waitset_reserve(&shell->children, p->jobs))
+		return (free(p->slots), free(p->outputs), free(p->status), 1);
+	i = -1;
+	while (++i < p->count)
+	{
+		p->outputs[i] = -1;
+		p->status[i] = -1;
+	}
+	fflush(stdout);
+	while (p->next < p->count || p->running > 0)
+	{
+		while (!p->interrupted && p->next < p->count
+			&& p->running < p->jobs && pmap_launch(p, shell))
+			;
+		if (p->running == 0)
+			break ;
+		if (!pmap_wait_one(p, shell))
+			p->interrupted = 1;
+		pmap_collect(p, shell);
+	}
+	i = 0;
+	while (i < p->next && p->status[i] == 0)
+		i++;
+	free(p->slots);
+	free(p->outputs);
+	free(p->status);
+	if (p->interrupted)
+		return (128 + SIGINT);
+	return ((i < p->count) * 123);
+}
+
+/**
+ * pmap_grow - Doubles the input buffer of pmap_read_items()
+ * @input: Buffer, NUL-free, holding len bytes
+ * @len: Bytes held
+ * @cap: Size of the buffer, updated
+ *
+ * Returns: the new buffer, or NULL (input freed) on allocation failure
+ */
+static char	*pmap_grow(char *input, size_t len, size_t *cap)
+{
+	char	*data;
+
+	data = malloc(*cap * 2);
+	if (data && len > 0)
+		ft_memcpy(data, input, len);
+	free(input);
+	*cap *= 2;
+	return (data);
+}
+
+/**
+ * pmap_read_items - Reads one item per line from stdin
+ * @p: pmap state
+ *
+ * Input is read into a buffer that doubles when full and split once at
+ * the end, so gathering it stays linear in its size. Empty lines are
+ * skipped.
+ *
+ * Returns: 1 on success, 0 on error
+ */
+int	pmap_read_items(t_pmap *p)
+{
+	char	*input;
+	size_t	len;
+	size_t	cap;
+	ssize_t	n;
+
+	cap = 4096;
+	len = 0;
+	input = malloc(cap);
+	n = 1;
+	while (input && n > 0)
+	{
+		if (len == cap - 1)
+			input = pmap_grow(input, len, &cap);
+		if (!input)
+			break ;
+		n = read(STDIN_FILENO, input + len, cap - 1 - len);
+		if (n > 0)
+			len += n;
+	}
+	if (!input || n < 0)
+		return (free(input), 0);
+	input[len] = '\0';
+	p->items = ft_split(input, '\n');
+	free(input);
+	p->items_owned = 1;
+	p->count = args_count(p->items);
+	return (p->items != NULL);
+}
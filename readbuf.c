@@ -0,0 +1,177 @@
+#include "includes/minishell.h"
+#include <sys/stat.h>
+
+/**
+ * readbuf_reserve - Makes room for at least one more byte
+ * @rb: Read buffer
+ *
+ * Unread data is first moved to the front; the buffer only grows for
+ * lines longer than what it already holds.
+ *
+ * Returns: 1 on success, 0 on allocation failure
+ */
+static int	readbuf_reserve(t_readbuf *rb)
+{
+	char	*data;
+
+	if (rb->pos > 0)
+	{
+		ft_memmove(rb->data, rb->data + rb->pos, rb->len - rb->pos);
+		rb->len -= rb->pos;
+		rb->pos = 0;
+	}
+	if (rb->len < rb->cap)
+		return (1);
+	data = malloc(rb->cap * 2 + READ_BLOCK);
+	if (!data)
+		return (0);
+	if (rb->len > 0)
+		ft_memcpy(data, rb->data, rb->len);
+	free(rb->data);
+	rb->data = data;
+	rb->cap = rb->cap * 2 + READ_BLOCK;
+	return (1);
+}
+
+/**
+ * readbuf_bytes - Reads a line one byte at a time
+ * @rb: Read buffer, used as scratch space
+ * @fd: Descriptor that is not a regular file (pipe, terminal)
+ * @delim: Line delimiter
+ *
+ * A pipe may be shared with the next command, so not a single byte
+ * after the delimiter may be consumed: this is the only case where
+ * `read` costs one system call per byte. EINTR (Ctrl-C) is not retried.
+ *
+ * Returns: 1 if the delimiter was read, 0 at end of file, -1 on error
+ */
+static int	readbuf_bytes(t_readbuf *rb, int fd, char delim)
+{
+	ssize_t	n;
+
+	rb->len = 0;
+	rb->pos = 0;
+	rb->off = -1;
+	while (1)
+	{
+		if (!readbuf_reserve(rb))
+			return (-1);
+		n = read(fd, rb->data + rb->len, 1);
+		if (n <= 0)
+			return ((int)n);
+		if (rb->data[rb->len++] == delim)
+			return (1);
+	}
+}
+
+/**
+ * readbuf_sync - Checks that the read-ahead belongs to fd
+ * @rb: Read buffer
+ * @fd: Regular file about to be read
+ * @st: Its fstat()
+ *
+ * The buffer outlives the redirections of a single command, so it is
+ * tagged with the file it came from and the offset of its first unread
+ * byte. Anything else (another file on stdin, a child that moved the
+ * shared offset) drops the read-ahead and restarts from the descriptor
+ * offset.
+ *
+ * Returns: 1 if the descriptor offset is known, 0 on lseek() failure
+ */
+static int	readbuf_sync(t_readbuf *rb, int fd, struct stat *st)
+{
+	off_t	cur;
+
+	cur = lseek(fd, 0, SEEK_CUR);
+	if (cur == -1)
+		return (0);
+	if (rb->off != cur || rb->dev != st->st_dev || rb->ino != st->st_ino)
+	{
+		rb->len = 0;
+		rb->pos = 0;
+		rb->off = cur;
+		rb->dev = st->st_dev;
+		rb->ino = st->st_ino;
+	}
+	return (1);
+}
+
+/**
+ * readbuf_fill - Reads the next block after the buffered data
+ * @rb: Read buffer, in sync with fd
+ * @fd: Regular file
+ *
+ * pread() leaves the descriptor offset alone, so reading ahead never
+ * moves it past the lines handed out.
+ *
+ * Returns: Bytes read, 0 at end of file, -1 on error
+ */
+static ssize_t	readbuf_fill(t_readbuf *rb, int fd)
+{
+	ssize_t	n;
+
+	if (!readbuf_reserve(rb))
+		return (-1);
+	n = pread(fd, rb->data + rb->len, rb->cap - rb->len,
+			rb->off + (rb->len - rb->pos));
+	if (n == -1)
+		return (-1);
+	rb->len += n;
+	return (n);
+}
+
+/**
+ * readbuf_line - Reads one line for the `read` builtin
+ * @rb: Read buffer kept in the shell between invocations; rb->delim
+ * ends the line
+ * @fd: Descriptor to read (stdin of the builtin)
+ * @line: Receives the start of the line; it points into the buffer and
+ * stays valid until the next call
+ * @len: Receives the length of the line, without the delimiter
+ *
+ * Regular files are read in READ_BLOCK chunks and a line then costs an
+ * fstat() and two lseek(): one to check the offset, one to leave it
+ * right after the delimiter, as POSIX requires of `read`, so commands
+ * run later on the same stdin carry on from the next line. Other
+ * descriptors are read byte by byte.
+ *
+ * Returns: 1 if a delimited line was read, 0 at end of file (the line
+ * holds whatever came before it), -1 on error (errno EINTR after a
+ * Ctrl-C)
+ */
+int	readbuf_line(t_readbuf *rb, int fd, char **line, size_t *len)
+{
+	struct stat	st;
+	char		*end;
+	ssize_t		n;
+
+	if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode)
+		|| !readbuf_sync(rb, fd, &st))
+	{
+		n = readbuf_bytes(rb, fd, rb->delim);
+		*line = rb->data;
+		*len = rb->len - (n == 1);
+		return ((int)n);
+	}
+	n = 1;
+	end = NULL;
+	while (!end && n > 0)
+	{
+		if (rb->len > rb->pos)
+			end = memchr(rb->data + rb->pos, rb->delim, rb->len - rb->pos);
+		if (!end)
+			n = readbuf_fill(rb, fd);
+	}
+	if (n < 0)
+		return (-1);
+	*line = rb->data + rb->pos;
+	*len = rb->len - rb->pos;
+	if (end)
+		*len = end - *line;
+	n = *len + (end != NULL);
+	if (lseek(fd, n, SEEK_CUR) == -1)
+		return (-1);
+	rb->pos += n;
+	rb->off += n;
+	return (end != NULL);
+}
@@ -0,0 +1,230 @@
+#define _GNU_SOURCE
+#include "includes/minishell.h"
+#include <sys/epoll.h>
+#include <sys/pidfd.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+
+/**
+ * waitset_init - Prepares an empty wait set
+ * @ws: Wait set to initialize
+ *
+ * Half of RLIMIT_NOFILE may be spent on pidfds; the rest stays
+ * available for pipes and redirections. The epoll instance lives as
+ * long as the shell.
+ *
+ * Returns: 1 on success, 0 if epoll is unavailable
+ */
+int	waitset_init(t_waitset *ws)
+{
+	struct rlimit	limit;
+
+	ft_memset(ws, 0, sizeof(t_waitset));
+	ws->epfd = -1;
+	ws->pidfd_budget = 512;
+	if (getrlimit(RLIMIT_NOFILE, &limit) == 0
+		&& limit.rlim_cur != RLIM_INFINITY)
+		ws->pidfd_budget = limit.rlim_cur / 2;
+	ws->epfd = epoll_create1(EPOLL_CLOEXEC);
+	return (ws->epfd != -1);
+}
+
+/**
+ * waitset_add - Starts tracking a freshly forked child
+ * @ws: Wait set (room must have been reserved with waitset_reserve())
+ * @pid: Pid returned by fork()
+ *
+ * Returns: Slot of the child
+ */
+int	waitset_add(t_waitset *ws, pid_t pid)
+{
+	int		slot;
+	t_child	*child;
+
+	slot = ws->free_slots[--ws->free_count];
+	child = &ws->slots[slot];
+	child->pid = pid;
+	child->pidfd = -1;
+	child->watched = 0;
+	child->status = -1;
+	child->used = 1;
+	clock_gettime(CLOCK_MONOTONIC, &child->started);
+	if (ws->pidfds < ws->pidfd_budget)
+		child->pidfd = pidfd_open(pid, 0);
+	if (child->pidfd != -1)
+		ws->pidfds++;
+	return (slot);
+}
+
+/**
+ * child_status - Converts a waitid() result into an exit status
+ * @info: siginfo filled by waitid()
+ *
+ * Returns: Exit code, or 128 + signal for killed children
+ */
+static int	child_status(siginfo_t *info)
+{
+	if (info->si_code == CLD_EXITED)
+		return (info->si_status);
+	return (128 + info->si_status);
+}
+
+/**
+ * waitset_reap - Collects the exit status of one child
+ * @ws: Wait set
+ * @slot: Slot of the child
+ * @options: 0 to block until the child exits, WNOHANG to only poll it
+ *
+ * Blocks only if the child is still running. The pidfd is removed from
+ * the epoll set before being closed: a forked child may still hold a
+ * copy, which would otherwise keep the registration alive. waitid() is
+ * called through syscall() because only the raw system call takes the
+ * rusage argument `time` reports.
+ *
+ * Returns: Exit status of the child, -1 if it is still running
+ */
+int	waitset_reap(t_waitset *ws, int slot, int options)
+{
+	t_child		*child;
+	siginfo_t	info;
+	int			ret;
+
+	child = &ws->slots[slot];
+	if (!child->used || child->status != -1)
+		return (child->status);
+	ft_memset(&info, 0, sizeof(info));
+	if (child->pidfd != -1)
+		ret = syscall(SYS_waitid, P_PIDFD, child->pidfd, &info,
+				WEXITED | options, &child->ru);
+	else
+		ret = syscall(SYS_waitid, P_PID, child->pid, &info,
+				WEXITED | options, &child->ru);
+	if (ret == -1 && errno == EINTR)
+		return (waitset_reap(ws, slot, options));
+	if (ret == 0 && info.si_pid == 0)
+		return (-1);
+	clock_gettime(CLOCK_MONOTONIC, &child->ended);
+	child->status = child_status(&info);
+	if (ret == -1)
+		child->status = 1;
+	PROBE2(cmd_exit, child->pid, child->status);
+	if (child->pidfd == -1)
+		return (child->status);
+	if (child->watched)
+		epoll_ctl(ws->epfd, EPOLL_CTL_DEL, child->pidfd, NULL);
+	close(child->pidfd);
+	child->pidfd = -1;
+	ws->pidfds--;
+	return (child->status);
+}
+
+/**
+ * waitset_wait - Waits for a group of children concurrently
+ * @ws: Wait set
+ * @slots: Slots of the children to wait for
+ * @n: Number of slots
+ * @timeout_ms: Maximum time to wait, or -1 to wait until all exit
+ *
+ * The pidfds are watched through epoll, so the children are reaped in
+ * whatever order they exit. Any other child that exits meanwhile (a
+ * background job) is reaped as well and keeps its status in its slot.
+ * A lone child with no timeout is simply waited on through its pidfd.
+ * Children beyond the pidfd budget are reaped last, by pid (only polled
+ * when there is a timeout).
+ *
+ * Returns: Number of children still running (0 unless timed out)
+ */
+int	waitset_wait(t_waitset *ws, int *slots, int n, int timeout_ms)
+{
+	struct epoll_event	events[WAITSET_EVENTS];
+	struct timespec		deadline;
+	int					ready;
+	int					i;
+
+	if (n == 1 && timeout_ms < 0)
+		return (waitset_reap(ws, slots[0], 0), 0);
+	deadline_init(&deadline, timeout_ms);
+	i = 0;
+	while (i < n)
+		waitset_watch(ws, slots[i++]);
+	while (waitset_pending(ws, slots, n) > 0)
+	{
+		ready = epoll_wait(ws->epfd, events, WAITSET_EVENTS,
+				deadline_left(&deadline, timeout_ms));
+		if (ready <= 0)
+			break ;
+		i = 0;
+		while (i < ready)
+			waitset_reap(ws, events[i++].data.u32, 0);
+	}
+	i = 0;
+	while (i < n)
+		waitset_reap(ws, slots[i++], WNOHANG * (timeout_ms >= 0));
+	return (waitset_running(ws, slots, n));
+}
+
+/**
+ * waitset_wait_any - Waits until at least one child of a group exits
+ * @ws: Wait set
+ * @slots: Slots of the children
+ * @n: Number of slots
+ *
+ * Unlike waitset_wait(), a signal interrupts the wait: epoll_wait() is
+ * never restarted, so the caller gets a chance to give up.
+ *
+ * Returns: Number of children still running, or -1 if interrupted
+ */
+int	waitset_wait_any(t_waitset *ws, int *slots, int n)
+{
+	struct epoll_event	events[WAITSET_EVENTS];
+	int					ready;
+	int					i;
+
+	i = 0;
+	while (i < n)
+		waitset_watch(ws, slots[i++]);
+	if (waitset_pending(ws, slots, n) == 0)
+	{
+		i = 0;
+		while (i < n && ws->slots[slots[i]].status != -1)
+			i++;
+		if (i < n)
+			waitset_reap(ws, slots[i], 0);
+		return (waitset_running(ws, slots, n));
+	}
+	ready = epoll_wait(ws->epfd, events, WAITSET_EVENTS, -1);
+	if (ready == -1)
+		return (-1);
+	i = 0;
+	while (i < ready)
+		waitset_reap(ws, events[i++].data.u32, 0);
+	return (waitset_running(ws, slots, n));
+}
+
+/**
+ * waitset_free - Releases a wait set
+ * @ws: Wait set to free
+ *
+ * Running children are not waited for; only the descriptors go.
+ */
+void	waitset_free(t_waitset *ws)
+{
+	int	i;
+
+	i = 0;
+	while (i < ws->cap)
+	{
+		if (ws->slots[i].used && ws->slots[i].pidfd != -1)
+			close(ws->slots[i].pidfd);
+		i++;
+	}
+	if (ws->epfd != -1)
+		close(ws->epfd);
+	free(ws->slots);
+	free(ws->free_slots);
+	ws->slots = NULL;
+	ws->free_slots = NULL;
+	ws->cap = 0;
+	ws->free_count = 0;
+	ws->epfd = -1;
+}
@@ -0,0 +1,140 @@
+#define _GNU_SOURCE
+#include "includes/minishell.h"
+#include <sys/epoll.h>
+
+/**
+ * waitset_reserve - Makes sure n more children can be tracked
+ * @ws: Wait set
+ * @n: Number of children about to be forked
+ *
+ * Reserving before forking means waitset_add() cannot fail once a child
+ * exists. Slots are copied, never reordered, so indexes stay valid.
+ *
+ * Returns: 1 on success, 0 on allocation failure
+ */
+int	waitset_reserve(t_waitset *ws, int n)
+{
+	t_child	*slots;
+	int		*free_slots;
+	int		cap;
+	int		i;
+
+	if (ws->free_count >= n)
+		return (1);
+	cap = ws->cap * 2 + 16;
+	while (cap - ws->cap + ws->free_count < n)
+		cap *= 2;
+	slots = malloc(sizeof(t_child) * cap);
+	free_slots = malloc(sizeof(int) * cap);
+	if (!slots || !free_slots)
+		return (free(slots), free(free_slots), 0);
+	if (ws->cap)
+		ft_memcpy(slots, ws->slots, sizeof(t_child) * ws->cap);
+	if (ws->free_count)
+		ft_memcpy(free_slots, ws->free_slots, sizeof(int) * ws->free_count);
+	free(ws->slots);
+	free(ws->free_slots);
+	ws->slots = slots;
+	ws->free_slots = free_slots;
+	i = cap;
+	while (i > ws->cap)
+	{
+		ws->slots[--i].used = 0;
+		ws->free_slots[ws->free_count++] = i;
+	}
+	ws->cap = cap;
+	return (1);
+}
+
+/**
+ * waitset_release - Gives the slot of a reaped child back
+ * @ws: Wait set
+ * @slot: Slot to release (its child must have been reaped)
+ */
+void	waitset_release(t_waitset *ws, int slot)
+{
+	if (!ws->slots[slot].used || ws->slots[slot].status == -1)
+		return ;
+	ws->slots[slot].used = 0;
+	ws->free_slots[ws->free_count++] = slot;
+}
+
+/**
+ * waitset_watch - Registers the pidfd of a child in the epoll set
+ * @ws: Wait set
+ * @slot: Slot of the child
+ *
+ * Registration is deferred until a child is actually waited on through
+ * epoll, so a lone foreground command never pays for it. The event data
+ * carries the slot index.
+ *
+ * Returns: 1 if the child is watched, 0 otherwise
+ */
+int	waitset_watch(t_waitset *ws, int slot)
+{
+	struct epoll_event	event;
+	t_child				*child;
+
+	child = &ws->slots[slot];
+	if (child->watched)
+		return (1);
+	if (child->pidfd == -1 || child->status != -1)
+		return (0);
+	if (ws->epfd == -1)
+		return (0);
+	ft_memset(&event, 0, sizeof(event));
+	event.events = EPOLLIN;
+	event.data.u32 = slot;
+	if (epoll_ctl(ws->epfd, EPOLL_CTL_ADD, child->pidfd, &event) == -1)
+		return (0);
+	child->watched = 1;
+	return (1);
+}
+
+/**
+ * waitset_pending - Counts watched children that are still running
+ * @ws: Wait set
+ * @slots: Slots to look at
+ * @n: Number of slots
+ *
+ * Returns: Number of running children an epoll event will report
+ */
+int	waitset_pending(t_waitset *ws, int *slots, int n)
+{
+	int	count;
+	int	i;
+
+	count = 0;
+	i = 0;
+	while (i < n)
+	{
+		if (ws->slots[slots[i]].watched && ws->slots[slots[i]].status == -1)
+			count++;
+		i++;
+	}
+	return (count);
+}
+
+/**
+ * waitset_running - Counts children that have not been reaped yet
+ * @ws: Wait set
+ * @slots: Slots to look at
+ * @n: Number of slots
+ *
+ * Returns: Number of children still running
+ */
+int	waitset_running(t_waitset *ws, int *slots, int n)
+{
+	int	count;
+	int	i;
+
+	count = 0;
+	i = 0;
+	while (i < n)
+	{
+		if (ws->slots[slots[i]].status == -1)
+			count++;
+		i++;
+	}
+	return (count);
+}
@@ -0,0 +1,160 @@
+#define _GNU_SOURCE
+#include "includes/minishell.h"
+
+/**
+ * redir_error - Reports a redirection target that could not be opened
+ * @file: Target of the redirection
+ */
+static void	redir_error(char *file)
+{
+	ft_putstr_fd("minishell: ", 2);
+	ft_putstr_fd(file, 2);
+	ft_putstr_fd(": ", 2);
+	ft_putstr_fd(strerror(errno), 2);
+	ft_putstr_fd("\n", 2);
+}
+
+/**
+ * redir_open_one - Opens the descriptor for a single redirection
+ * @redir: Redirection to open
+ *
+ * Heredoc and herestring bodies were already collected into redir->fd
+ * and stay owned by the AST. Files are opened close-on-exec, so once
+ * they are dup'd onto stdin/stdout nothing has to close them before
+ * execve().
+ *
+ * Returns: Descriptor, or -1 on failure
+ */
+static int	redir_open_one(t_redir_node *redir)
+{
+	if (redir->type == NODE_HEREDOC || redir->type == NODE_HERESTRING)
+		return (redir->fd);
+	if (redir->type == NODE_REDIR_IN)
+		return (open(redir->file, O_RDONLY | O_CLOEXEC));
+	if (redir->type == NODE_REDIR_APPEND)
+		return (open(redir->file, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC,
+				0644));
+	return (open(redir->file, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644));
+}
+
+/**
+ * plan_set - Records a descriptor as the new target of one stream
+ * @target: Plan slot (plan->in or plan->out)
+ * @owned: Ownership flag of that slot
+ * @fd: Newly opened descriptor
+ * @is_body: 1 if fd is a heredoc body owned by the AST
+ *
+ * Only the last redirection of each direction is ever dup'd, so an
+ * overridden descriptor is closed right away instead of being applied.
+ */
+static void	plan_set(int *target, int *owned, int fd, int is_body)
+{
+	if (*owned)
+		close(*target);
+	*target = fd;
+	*owned = !is_body;
+}
+
+/**
+ * redirect_open - Opens every redirection of a command, in order
+ * @redir: First redirection of the command
+ * @plan: Plan receiving the final stdin/stdout descriptors
+ *
+ * Every target is opened (so "> a > b" still creates a), but only the
+ * last one per direction is kept. Safe to run in the parent before
+ * forking: a failing target is reported here and no process is spent.
+ *
+ * Returns: 1 on success, 0 on failure (plan is released)
+ */
+int	redirect_open(t_redir_node *redir, t_redir_plan *plan)
+{
+	int	fd;
+	int	is_body;
+
+	plan->in = -1;
+	plan->out = -1;
+	plan->in_owned = 0;
+	plan->out_owned = 0;
+	plan->saved_in = -1;
+	plan->saved_out = -1;
+	while (redir)
+	{
+		fd = redir_open_one(redir);
+		if (fd == -1)
+		{
+			redir_error(redir->file);
+			redirect_close(plan);
+			return (0);
+		}
+		is_body = (redir->type == NODE_HEREDOC
+				|| redir->type == NODE_HERESTRING);
+		if (redir->type == NODE_REDIR_IN || is_body)
+			plan_set(&plan->in, &plan->in_owned, fd, is_body);
+		else
+			plan_set(&plan->out, &plan->out_owned, fd, 0);
+		redir = redir->next;
+	}
+	return (1);
+}
+
+/**
+ * redirect_apply - Points stdin/stdout at the planned descriptors
+ * @plan: Plan built by redirect_open()
+ *
+ * At most one dup2() per stream. Nothing is closed here: the sources
+ * are close-on-exec, and children drop every stray descriptor with a
+ * single close_range() (see redirect_child()). A source that already
+ * is the stream (stdin or stdout was closed when it was opened) only
+ * has its close-on-exec flag cleared.
+ *
+ * Returns: 1 on success, 0 on failure
+ */
+int	redirect_apply(t_redir_plan *plan)
+{
+	if (plan->in == STDIN_FILENO && fcntl(STDIN_FILENO, F_SETFD, 0) == -1)
+		return (0);
+	if (plan->in != -1 && plan->in != STDIN_FILENO
+		&& dup2(plan->in, STDIN_FILENO) == -1)
+		return (0);
+	if (plan->out == STDOUT_FILENO && fcntl(STDOUT_FILENO, F_SETFD, 0) == -1)
+		return (0);
+	if (plan->out != -1 && plan->out != STDOUT_FILENO
+		&& dup2(plan->out, STDOUT_FILENO) == -1)
+		return (0);
+	return (1);
+}
+
+/**
+ * redirect_child - Final descriptor setup of a child before execve()
+ * @plan: Plan built by redirect_open()
+ *
+ * Applies the plan, then closes every descriptor above stderr (pipe
+ * ends, heredoc bodies, the plan itself) with one close_range().
+ *
+ * Returns: 1 on success, 0 on failure
+ */
+int	redirect_child(t_redir_plan *plan)
+{
+	if (!redirect_apply(plan))
+		return (0);
+	close_range(STDERR_FILENO + 1, ~0U, 0);
+	return (1);
+}
+
+/**
+ * redirect_close - Releases the descriptors opened for a plan
+ * @plan: Plan to release
+ *
+ * Heredoc bodies are left alone; they belong to the AST.
+ */
+void	redirect_close(t_redir_plan *plan)
+{
+	if (plan->in_owned)
+		close(plan->in);
+	if (plan->out_owned)
+		close(plan->out);
+	plan->in = -1;
+	plan->out = -1;
+	plan->in_owned = 0;
+	plan->out_owned = 0;
+}
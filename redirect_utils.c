@@ -0,0 +1,52 @@
+#include "includes/minishell.h"
+
+/**
+ * redirect_save - Applies a plan in the shell process itself
+ * @plan: Plan built by redirect_open()
+ *
+ * Used for builtins, which run without forking. Only the streams the
+ * plan actually redirects are saved (close-on-exec, above the range a
+ * script is likely to use) before being replaced.
+ *
+ * Returns: 1 on success, 0 on failure (nothing is left redirected)
+ */
+int	redirect_save(t_redir_plan *plan)
+{
+	if (plan->in != -1)
+		plan->saved_in = fcntl(STDIN_FILENO, F_DUPFD_CLOEXEC, 10);
+	if (plan->out != -1)
+		plan->saved_out = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, 10);
+	if ((plan->in != -1 && plan->saved_in == -1)
+		|| (plan->out != -1 && plan->saved_out == -1)
+		|| !redirect_apply(plan))
+	{
+		perror("minishell: redirect");
+		redirect_restore(plan);
+		return (0);
+	}
+	return (1);
+}
+
+/**
+ * redirect_restore - Gives the shell its own stdin/stdout back
+ * @plan: Plan previously applied with redirect_save()
+ *
+ * Pending stdio output belongs to the redirected stream, so it is
+ * flushed before stdout is switched back.
+ */
+void	redirect_restore(t_redir_plan *plan)
+{
+	if (plan->saved_out != -1)
+	{
+		fflush(stdout);
+		dup2(plan->saved_out, STDOUT_FILENO);
+		close(plan->saved_out);
+		plan->saved_out = -1;
+	}
+	if (plan->saved_in != -1)
+	{
+		dup2(plan->saved_in, STDIN_FILENO);
+		close(plan->saved_in);
+		plan->saved_in = -1;
+	}
+}
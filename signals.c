@@ -1,15 +1,15 @@
 #include "includes/minishell.h"
 
+// so corre enquanto o shell espera input: durante a execucao de comandos
+// o SIGINT e ignorado (setup_exec_signals), os filhos sao colhidos pelo
+// wait set e nunca aqui
 void	sigint_handler(int sig)
 {
 	(void)sig;
-	if (-1 == waitpid(-1, NULL, WNOHANG))
-	{
-		write(1, "\n", 1);
-		rl_on_new_line();
-		rl_replace_line("", 0);
-		rl_redisplay();
-	}
+	write(1, "\n", 1);
+	rl_on_new_line();
+	rl_replace_line("", 0);
+	rl_redisplay();
 }
 
 // funcao para dar handle ao sinais
@@ -24,3 +24,39 @@ void	setup_signals(void)
 	sigaction(SIGINT, &sa, NULL);
 	signal(SIGQUIT, SIG_IGN);
 }
+
+// antes de lancar filhos em foreground: o Ctrl-C mata os filhos, o shell
+// so espera por eles (setup_signals volta a instalar o handler no prompt)
+void	setup_exec_signals(void)
+{
+	signal(SIGINT, SIG_IGN);
+}
+
+// durante os builtins corridos no proprio shell (wait, pmap, cat, read...):
+// o Ctrl-C so interrompe a syscall em curso (sem SA_RESTART volta com
+// EINTR) e fica registado para as copias que o kernel faz aos bocados;
+// quem escreve e o shell_loop
+static volatile sig_atomic_t	g_sigint;
+
+static void	wait_sigint_handler(int sig)
+{
+	(void)sig;
+	g_sigint = 1;
+}
+
+void	setup_wait_signals(void)
+{
+	struct sigaction	sa;
+
+	g_sigint = 0;
+	sigemptyset(&sa.sa_mask);
+	sa.sa_flags = 0;
+	sa.sa_handler = &wait_sigint_handler;
+	sigaction(SIGINT, &sa, NULL);
+}
+
+// 1 se houve um Ctrl-C desde o ultimo setup_wait_signals
+int	sigint_received(void)
+{
+	return (g_sigint);
+}
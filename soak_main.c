@@ -0,0 +1,177 @@
+#include "includes/minishell.h"
+#include <stdio.h>
+#include <malloc.h>
+
+// ANSI Colors
+#define GREEN   "\033[32m"
+#define RED     "\033[31m"
+#define CYAN    "\033[36m"
+#define BOLD    "\033[1m"
+#define RESET   "\033[0m"
+
+#define SOAK_SAMPLES 20
+#define SOAK_FORK_EVERY 10000
+
+typedef struct s_soak_sample {
+	long	line;
+	long	rss;             // Resident set size, in bytes
+	long	inuse;           // Bytes malloc has handed out (mallinfo2)
+	long	live;            // Bytes live according to the mem.c wrappers
+} t_soak_sample;
+
+// Lines cycled through by the soak; %ld is the line number
+static const char	*g_lines[] = {
+	"echo $HOME \"a$USER b\" 'lit $x' $?",
+	"export SOAK_%ld=value_%ld",
+	"unset SOAK_%ld",
+	"cd . && pwd",
+	"test %ld -gt 5 || echo no",
+	"printf '%%s-%%d\\n' ab %ld > /dev/null",
+	"A=1 ; echo \"$A\" > /dev/null",
+	"false || echo $PWD >> /dev/null",
+	"echo ( bad",
+	"| echo",
+	"echo \"unterminated",
+	"nonexistent_builtin_%ld",
+	NULL
+};
+
+static long	soak_rss(void)
+{
+	char	buf[128];
+	long	pages;
+	int		fd;
+	int		n;
+	int		i;
+
+	fd = open("/proc/self/statm", O_RDONLY);
+	if (fd == -1)
+		return (0);
+	n = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (n <= 0)
+		return (0);
+	buf[n] = '\0';
+	i = 0;
+	while (buf[i] && buf[i] != ' ')
+		i++;
+	pages = atol(buf + i);
+	return (pages * sysconf(_SC_PAGESIZE));
+}
+
+static void	soak_sample(t_soak_sample *s, long line)
+{
+	struct mallinfo2	mi;
+
+	mi = mallinfo2();
+	s->line = line;
+	s->rss = soak_rss();
+	s->inuse = mi.uordblks + mi.hblkhd;
+	s->live = mem_live();
+}
+
+// Runs one line the way shell_loop() does, heredocs aside
+static void	soak_run(char *line, t_shell *shell)
+{
+	t_token		*tokens;
+	t_ast_node	*ast;
+
+	tokens = lexer(line);
+	if (!tokens)
+		return ;
+	ast = parse(tokens);
+	if (ast && TOKEN_EOF != tokens->type && expand_ast(ast, shell))
+		shell->exit_status = execute_ast(ast, shell);
+	else if (!ast)
+		shell->exit_status = 2;
+	ast_free(ast);
+	token_lstclear(&tokens);
+}
+
+static void	soak_line(char *buf, size_t size, long n)
+{
+	long	i;
+
+	i = n % (sizeof(g_lines) / sizeof(*g_lines) - 1);
+	if (n % SOAK_FORK_EVERY == SOAK_FORK_EVERY - 1)
+		snprintf(buf, size, "/bin/true | echo %ld > /dev/null", n);
+	else if (i == 2)
+		snprintf(buf, size, g_lines[i], n - 1);
+	else
+		snprintf(buf, size, g_lines[i], n, n);
+}
+
+static void	soak_print(int out, t_soak_sample *s, t_soak_sample *base)
+{
+	dprintf(out, "%10ld  rss %8ld KB (%+7ld)  malloc %8ld KB (%+7ld)"
+		"  live %+9ld B\n", s->line, s->rss / 1024,
+		(s->rss - base->rss) / 1024, s->inuse / 1024,
+		(s->inuse - base->inuse) / 1024, s->live - base->live);
+}
+
+/*
+** Usage: soak [lines] [max growth in KB]
+** Drives generated lines through lexer, parser, expander and executor
+** with stdout and stderr sent to /dev/null, sampling memory
+** SOAK_SAMPLES times. The first sample (after 1/SOAK_SAMPLES of the
+** lines, so buffers and the environment have reached their size) is the
+** baseline; the soak fails when RSS or the bytes in use in malloc grew
+** past the bound by the end.
+*/
+int	main(int ac, char **av, char **envp)
+{
+	t_shell			shell;
+	t_soak_sample	base;
+	t_soak_sample	s;
+	char			line[256];
+	long			lines;
+	long			bound;
+	long			n;
+	long			step;
+	int				out;
+	int				null;
+
+	lines = 1000000;
+	if (ac > 1)
+		lines = atol(av[1]);
+	bound = 1024;
+	if (ac > 2)
+		bound = atol(av[2]);
+	ft_memset(&shell, 0, sizeof(t_shell));
+	init_shell(envp, &shell);
+	mem_stats_start();
+	out = dup(1);
+	dprintf(out, "%s%s=== soak: %ld lines, bound %ld KB ===%s\n", BOLD, CYAN,
+		lines, bound, RESET);
+	null = open("/dev/null", O_WRONLY);
+	dup2(null, 1);
+	dup2(null, 2);
+	close(null);
+	step = lines / SOAK_SAMPLES + (lines < SOAK_SAMPLES);
+	n = 0;
+	while (n < lines)
+	{
+		soak_line(line, sizeof(line), n);
+		soak_run(line, &shell);
+		if (++n % step && n != lines)
+			continue ;
+		soak_sample(&s, n);
+		if (n == step)
+			base = s;
+		soak_print(out, &s, &base);
+	}
+	if ((s.rss - base.rss) / 1024 > bound
+		|| (s.inuse - base.inuse) / 1024 > bound)
+	{
+		dprintf(out, "%sFAIL: memory grew past %ld KB%s\n", RED, bound, RESET);
+		return (1);
+	}
+	dprintf(out, "%sOK: growth within %ld KB%s\n", GREEN, bound, RESET);
+	jobs_clear(&shell);
+	waitset_free(&shell.children);
+	free(shell.pipestatus);
+	free(shell.readbuf.data);
+	free(shell.cwd.path);
+	env_free(&shell);
+	return (0);
+}
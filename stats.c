@@ -0,0 +1,12 @@
+#include "includes/minishell.h"
+
+/**
+ * stats_stage - Adds the time since start to a stage of shellstats
+ * @shell: Shell context
+ * @stage: STAT_LEX, STAT_PARSE, STAT_EXPAND or STAT_EXEC
+ * @start: trace_now() when the stage began
+ */
+void	stats_stage(t_shell *shell, int stage, long start)
+{
+	shell->stats.ns[stage] += trace_now() - start;
+}
@@ -0,0 +1,384 @@
+#include "includes/minishell.h"
+#include <stdio.h>
+#include <sys/stat.h>
+
+// ANSI Colors
+#define GREEN   "\033[32m"
+#define RED     "\033[31m"
+#define YELLOW  "\033[33m"
+#define CYAN    "\033[36m"
+#define BOLD    "\033[1m"
+#define RESET   "\033[0m"
+
+typedef struct s_builtin_test {
+	char	*input;
+	char	*desc;
+	int		expected_status;
+	char	*expected_out;   // Expected content of ./out, or NULL
+} t_builtin_test;
+
+// write() calls of the shell process, counted through --wrap=write
+static int	g_writes;
+
+ssize_t	__real_write(int fd, const void *buf, size_t n);
+
+ssize_t	__wrap_write(int fd, const void *buf, size_t n)
+{
+	g_writes++;
+	return (__real_write(fd, buf, n));
+}
+
+static char	*read_file(char *path)
+{
+	static char	buf[256];
+	int			fd;
+	ssize_t		n;
+
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return (NULL);
+	n = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (n < 0)
+		return (NULL);
+	buf[n] = '\0';
+	return (buf);
+}
+
+static int	run_builtin_test(t_builtin_test *test, t_shell *shell)
+{
+	t_token		*tokens;
+	t_ast_node	*ast;
+	char		*content;
+	int			status;
+	int			passed;
+
+	ft_printf("%s=== Test: %s ===%s\n", BOLD, test->desc, RESET);
+	ft_printf("%sInput:%s '%s'\n", YELLOW, RESET, test->input);
+	tokens = lexer(test->input);
+	ast = parse(tokens);
+	status = -1;
+	if (ast && collect_heredocs(ast, shell) && expand_ast(ast, shell))
+		status = execute_ast(ast, shell);
+	passed = (status == test->expected_status);
+	content = NULL;
+	if (passed && test->expected_out)
+	{
+		content = read_file("out");
+		passed = (content && !ft_strcmp(content, test->expected_out));
+	}
+	if (passed)
+		ft_printf("  %s✓ PASS:%s Status %d\n", GREEN, RESET, status);
+	else if (content || test->expected_out)
+		ft_printf("  %s✗ FAIL:%s out '%s'\n", RED, RESET,
+			content ? content : "NULL");
+	else
+		ft_printf("  %s✗ FAIL:%s Expected status %d, got %d\n", RED, RESET,
+			test->expected_status, status);
+	ast_free(ast);
+	token_lstclear(&tokens);
+	ft_printf("\n");
+	return (passed);
+}
+
+// Runs a builtin quietly and checks it made at most max write() calls
+static int	run_write_test(char *input, int max, t_shell *shell)
+{
+	t_token		*tokens;
+	t_ast_node	*ast;
+	int			writes;
+
+	ft_printf("%s=== Test: %s writes in one call per buffer ===%s\n", BOLD,
+		input, RESET);
+	tokens = lexer(input);
+	ast = parse(tokens);
+	writes = -1;
+	if (ast && expand_ast(ast, shell))
+	{
+		g_writes = 0;
+		execute_ast(ast, shell);
+		writes = g_writes;
+	}
+	ast_free(ast);
+	token_lstclear(&tokens);
+	if (writes >= 0 && writes <= max)
+		ft_printf("  %s✓ PASS:%s %d writes\n\n", GREEN, RESET, writes);
+	else
+		ft_printf("  %s✗ FAIL:%s %d writes, expected at most %d\n\n", RED,
+			RESET, writes, max);
+	return (writes >= 0 && writes <= max);
+}
+
+// Grows the environment to n variables, returns the size env prints
+static size_t	big_env(t_shell *shell, int n)
+{
+	char	name[32];
+	size_t	size;
+	int		i;
+
+	i = 0;
+	while (shell->env.len < n)
+	{
+		snprintf(name, sizeof(name), "BIG_%d", i++);
+		env_set(shell, name, "some value", 10);
+	}
+	size = 0;
+	i = 0;
+	while (shell->envp[i])
+		size += ft_strlen(shell->envp[i++]) + 1;
+	return (size);
+}
+
+// Writes size bytes of a repeating, non-zero pattern
+static void	make_file(char *name, size_t size)
+{
+	char	buf[4096];
+	size_t	i;
+	int		fd;
+
+	i = 0;
+	while (i < sizeof(buf))
+	{
+		buf[i] = 'a' + i % 26;
+		i++;
+	}
+	fd = open(name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	while (size > 0)
+	{
+		i = size;
+		if (i > sizeof(buf))
+			i = sizeof(buf);
+		write(fd, buf, i);
+		size -= i;
+	}
+	close(fd);
+}
+
+int	main(int ac, char **av, char **envp)
+{
+	t_shell	shell;
+	char	dir[] = "/tmp/minishell_builtins_XXXXXX";
+	int		fd;
+
+	(void)ac;
+	(void)av;
+	if (!mkdtemp(dir) || chdir(dir) == -1)
+		return (1);
+	ft_memset(&shell, 0, sizeof(t_shell));
+	init_shell(envp, &shell);
+	fd = open("file", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	write(fd, "x", 1);
+	close(fd);
+	close(open("empty", O_WRONLY | O_CREAT | O_TRUNC, 0644));
+	symlink("file", "link");
+	mkdir("d", 0755);
+	symlink("d", "dl");
+	make_file("f4k", 4096);
+	make_file("f1m", 1 << 20);
+	fd = open("lines", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	write(fd, "one  two three\n a\\ b\\\nc \nlast", 30);
+	close(fd);
+
+	t_builtin_test tests[] = {
+		// ========== TRUE, FALSE, : ==========
+		{"true", "true succeeds", 0, NULL},
+		{"false", "false fails", 1, NULL},
+		{": ignored args", ": ignores its arguments", 0, NULL},
+
+		// ========== FILES ==========
+		{"test -f file", "-f on a regular file", 0, NULL},
+		{"test -f .", "-f on a directory", 1, NULL},
+		{"test -d .", "-d on a directory", 0, NULL},
+		{"test -e missing", "-e on a missing file", 1, NULL},
+		{"test -s file", "-s on a non-empty file", 0, NULL},
+		{"test -s empty", "-s on an empty file", 1, NULL},
+		{"test -L link", "-L on a symlink", 0, NULL},
+		{"test -L file", "-L on a regular file", 1, NULL},
+		{"test -r file", "-r on a readable file", 0, NULL},
+		{"test -x file", "-x on a file without x bit", 1, NULL},
+
+		// ========== STRINGS ==========
+		{"test abc", "Non-empty string", 0, NULL},
+		{"test ''", "Empty string", 1, NULL},
+		{"test -n ''", "-n on an empty string", 1, NULL},
+		{"test -z ''", "-z on an empty string", 0, NULL},
+		{"test -n", "One argument is a string test", 0, NULL},
+		{"test a = a", "= on equal strings", 0, NULL},
+		{"test a != a", "!= on equal strings", 1, NULL},
+		{"test a '<' b", "< compares strings", 0, NULL},
+
+		// ========== INTEGERS ==========
+		{"test 10 -gt 9", "-gt compares numbers, not strings", 0, NULL},
+		{"test -3 -lt -2", "Negative numbers", 0, NULL},
+		{"test ' 7 ' -eq 7", "Spaces around numbers are allowed", 0, NULL},
+		{"test 1x -eq 1", "ERROR: integer expression expected", 2, NULL},
+		{"test 99999999999999999999 -gt 0", "ERROR: out of range", 2, NULL},
+
+		// ========== OPERATORS ==========
+		{"test ! -f file", "! negates", 1, NULL},
+		{"test -f file -a -d .", "-a needs both", 0, NULL},
+		{"test -f missing -o -d .", "-o needs one", 0, NULL},
+		{"test ! -f missing -a '(' a = b -o 1 -eq 1 ')'", "Grouping and precedence", 0, NULL},
+		{"test -q file", "ERROR: unary operator expected", 2, NULL},
+		{"test a b c d e", "ERROR: too many arguments", 2, NULL},
+
+		// ========== [ ==========
+		{"[ -f file ]", "[ with closing ]", 0, NULL},
+		{"[ a = b ]", "[ false comparison", 1, NULL},
+		{"[ ]", "[ ] is false", 1, NULL},
+		{"[ -f file", "ERROR: [ without ]", 2, NULL},
+		{"[ -f file ] && true || false", "[ in an and-or list", 0, NULL},
+
+		// ========== CAT ==========
+		{"cat f4k > out && cmp -s f4k out", "cat copies a 4 KB file", 0, NULL},
+		{"cat f1m > out && cmp -s f1m out", "cat copies a 1 MB file to a file", 0, NULL},
+		{"cat < f1m | cat | cat > out && cmp -s f1m out", "cat through pipes", 0, NULL},
+		{"cat f4k f1m > out && cat f4k f1m | cmp -s - out", "cat concatenates", 0, NULL},
+		{"cat f4k > out && cat f4k >> out && cat f4k f4k | cmp -s - out", "cat appends", 0, NULL},
+		{"cat /proc/self/status > out && test -s out", "cat reads size-0 /proc files", 0, NULL},
+		{"cat -n f4k > out && test -s out", "Unsupported flag runs the external cat", 0, NULL},
+		{"cat missing f4k > out", "ERROR: cat of a missing file", 1, NULL},
+		{"cat out >> out", "ERROR: input file is output file", 1, NULL},
+
+		// ========== ECHO AND PRINTF ==========
+		{"echo -n a b > out", "echo -n joins its arguments", 0, "a b"},
+		{"printf '%s-%d\\n' a 1 > out", "printf %s and %d", 0, "a-1\n"},
+		{"printf '[%5s|%-5s|%.2s]' ab cd xyz > out", "Width, left align, precision", 0, "[   ab|cd   |xy]"},
+		{"printf '%05d %+d %x %X %#x %o %#o' 42 7 255 255 255 8 8 > out", "Number flags and bases", 0, "00042 +7 ff FF 0xff 10 010"},
+		{"printf '%.3d|%5.2d|%-4d|' 7 3 -1 > out", "Number precision and width", 0, "007|   03|-1  |"},
+		{"printf '%d ' 1 2 3 > out", "Format is reused for surplus arguments", 0, "1 2 3 "},
+		{"printf '%s=%s;' a 1 b > out", "Missing arguments are empty", 0, "a=1;b=;"},
+		{"printf '%c%c' hello world > out", "%c prints the first character", 0, "hw"},
+		{"printf '%b|%s' 'a\\tb\\c' 'x\\ty' next > out", "%b expands escapes and \\c stops", 0, "a\tb"},
+		{"printf 'x\\101\\x42\\q%%' > out", "Format escapes and %%", 0, "xAB\\q%"},
+		{"printf '%d' \"'A\" > out", "'c gives the character code", 0, "65"},
+		{"printf '%d|' 12abc 5 > out", "ERROR: invalid number", 1, "12|5|"},
+		{"printf '%z' > out", "ERROR: invalid format character", 1, ""},
+		{"printf > out", "ERROR: printf without a format", 2, ""},
+
+		// ========== READ ==========
+		{"read a b < lines && echo \"[$a][$b]\" > out", "Last name gets the rest", 0, "[one][two three]\n"},
+		{"read a b c d < lines && echo \"[$d]\" > out", "Missing fields are empty", 0, "[]\n"},
+		{"read < lines && echo \"[$REPLY]\" > out", "REPLY keeps the whole line", 0, "[one  two three]\n"},
+		{"read -d t a < lines && echo \"[$a]\" > out", "-d sets the delimiter", 0, "[one]\n"},
+		{"read a < empty ; echo \"$? [$a]\" > out", "EOF returns 1", 0, "1 []\n"},
+		{"read -q", "ERROR: invalid option", 2, NULL},
+		{"read 1a < lines", "ERROR: invalid identifier", 1, NULL},
+
+		// ========== EXPORT AND UNSET ==========
+		{"export X1=a X2=b X1=c && echo \"$X1$X2\" > out", "export adds and replaces", 0, "cb\n"},
+		{"unset X1 NOPE && echo \"[$X1][$X2]\" > out", "unset removes, ignores unknown names", 0, "[][b]\n"},
+		{"export LC_ALL=C && export > out && sort -C -t= -k1,1 out", "export lists sorted by name", 0, NULL},
+		{"unset X2 && export | grep -c X2 > out", "Unset variables leave the listing", 1, "0\n"},
+
+		// ========== CD AND PWD ==========
+		{"cd dl && pwd | grep -q '/dl$'", "pwd keeps the logical path", 0, NULL},
+		{"pwd -P | grep -q '/d$'", "pwd -P resolves links", 0, NULL},
+		{"test \"$OLDPWD/dl\" = \"$PWD\"", "cd updates PWD and OLDPWD", 0, NULL},
+		{"cd .. && test -f file", "cd .. goes back through the link", 0, NULL},
+		{"cd dl/../dl/. && cd - > out && test -f file", "cd - returns to OLDPWD", 0, NULL},
+		{"mkdir m && cd m && /bin/mv ../m ../m2", "Directory renamed under the shell", 0, NULL},
+		{"pwd | grep -q '/m2$'", "Stale PWD is revalidated", 0, NULL},
+		{"cd .. && rmdir m2 && test -f file", "cd .. from the revalidated path", 0, NULL},
+		{"cd missing", "ERROR: cd to a missing directory", 1, NULL},
+		{"cd -q", "ERROR: cd invalid option", 2, NULL},
+
+		// ========== SHELLSTATS ==========
+		{"shellstats | grep -c '^builtins  *[1-9]' > out", "shellstats counts builtins", 0, "1\n"},
+		{"echo 'a' b > /dev/null && shellstats | grep -q '^not_expanded  *[1-9]'", "Single-quoted words are not expanded", 0, NULL},
+		{"/bin/true && shellstats | grep -q '^forks  *[1-9]'", "shellstats counts forks", 0, NULL},
+		{"shellstats --json | grep -c '^{\"lines\":[0-9]*,\"tokens\":.*_ns\":[0-9]*}$' > out", "--json prints one object", 0, "1\n"},
+		{"shellstats -x", "ERROR: shellstats invalid option", 2, NULL},
+	};
+
+	// Shared stdin: every read consumes exactly one line of it
+	t_builtin_test stdin_tests[] = {
+		{"read a && echo \"[$a]\" > out", "First line of stdin", 0, "[one  two three]\n"},
+		{"read a b && echo \"[$a][$b]\" > out", "Backslashes escape and continue lines", 0, "[a bc][]\n"},
+		{"read -r a ; echo \"$? [$a]\" > out", "Unterminated last line", 0, "1 [last]\n"},
+		{"read a < lines && /bin/cat < lines > out", "Redirection drops the read-ahead", 0, "one  two three\n a\\ b\\\nc \nlast"},
+	};
+
+	int num_tests = sizeof(tests) / sizeof(tests[0]);
+	int passed = 0;
+	int failed = 0;
+	ft_printf("%s╔═══════════════════════════════════════════════╗%s\n", CYAN, RESET);
+	ft_printf("%s║   MINISHELL BUILTINS TEST SUITE               ║%s\n", CYAN, RESET);
+	ft_printf("%s╚═══════════════════════════════════════════════╝%s\n", CYAN, RESET);
+	for (int i = 0; i < num_tests; i++)
+	{
+		if (run_builtin_test(&tests[i], &shell))
+			passed++;
+		else
+			failed++;
+	}
+	fd = dup(0);
+	dup2(open("lines", O_RDONLY), 0);
+	for (int i = 0; i < (int)(sizeof(stdin_tests) / sizeof(stdin_tests[0])); i++)
+	{
+		num_tests++;
+		if (run_builtin_test(&stdin_tests[i], &shell))
+			passed++;
+		else
+			failed++;
+	}
+	dup2(fd, 0);
+	close(fd);
+
+	// 5000 variables: one write() per OUTBUF_SIZE bytes, not per line
+	size_t	size = big_env(&shell, 5000);
+	char	*write_tests[] = {"env > /dev/null", "export > /dev/null",
+		"echo a b c > /dev/null", "pwd > /dev/null"};
+	int		max_writes[] = {size / OUTBUF_SIZE + 1,
+		(size + 5000 * 11) / OUTBUF_SIZE + 1, 1, 1};
+	for (int i = 0; i < 4; i++)
+	{
+		num_tests++;
+		if (run_write_test(write_tests[i], max_writes[i], &shell))
+			passed++;
+		else
+			failed++;
+	}
+
+	// Index kept in sync while slots move under unset
+	t_builtin_test big_tests[] = {
+		{"unset BIG_100 BIG_0 BIG_70 && echo \"[$BIG_100][$BIG_71]\" > out", "Unset in a 5000-variable environment", 0, "[][some value]\n"},
+		{"export BIG_100=back && echo \"$BIG_100\" > out", "Re-export after unset", 0, "back\n"},
+		{"export > out && sort -C -t= -k1,1 out", "Listing still sorted", 0, NULL},
+		{"env | sort | uniq -d > out", "env sees every variable once", 0, ""},
+	};
+	for (int i = 0; i < 4; i++)
+	{
+		num_tests++;
+		if (run_builtin_test(&big_tests[i], &shell))
+			passed++;
+		else
+			failed++;
+	}
+	unlink("out");
+	unlink("lines");
+	unlink("f4k");
+	unlink("f1m");
+	unlink("link");
+	unlink("dl");
+	rmdir("d");
+	unlink("empty");
+	unlink("file");
+	chdir("/");
+	rmdir(dir);
+	jobs_clear(&shell);
+	waitset_free(&shell.children);
+	free(shell.pipestatus);
+	free(shell.readbuf.data);
+	free(shell.cwd.path);
+	env_free(&shell);
+	ft_printf("%s════════════════ RESULTS ═══════════════════%s\n", BOLD, RESET);
+	ft_printf("Total tests: %d\n", num_tests);
+	ft_printf("Passed: %s%d%s\n", GREEN, passed, RESET);
+	ft_printf("Failed: %s%d%s\n", failed > 0 ? RED : GREEN, failed, RESET);
+	if (failed == 0)
+		ft_printf("\n%s🎉 ALL TESTS PASSED! 🎉%s\n", GREEN, RESET);
+	else
+		ft_printf("\n%s⚠️  SOME TESTS FAILED ⚠️%s\n", YELLOW, RESET);
+	return (failed != 0);
+}
@@ -0,0 +1,350 @@
+#include "includes/minishell.h"
+#include <stdio.h>
+#include <dirent.h>
+
+// ANSI Colors
+#define GREEN   "\033[32m"
+#define RED     "\033[31m"
+#define YELLOW  "\033[33m"
+#define CYAN    "\033[36m"
+#define BOLD    "\033[1m"
+#define RESET   "\033[0m"
+
+typedef struct s_jobs_test {
+	char	*input;          // Command line, or NULL to generate jobs
+	int		jobs;            // Number of "true &" jobs to generate
+	char	*desc;
+	char	*expected_out;   // Expected content of ./out
+	int		max_ms;          // Maximum run time, or 0 for no limit
+	int		min_ms;          // Minimum run time, or 0 for no limit
+	char	*expected_err;   // Text expected on stderr, or NULL
+} t_jobs_test;
+
+static int	count_open_fds(void)
+{
+	DIR				*dir;
+	struct dirent	*entry;
+	int				count;
+
+	dir = opendir("/proc/self/fd");
+	if (!dir)
+		return (-1);
+	count = 0;
+	entry = readdir(dir);
+	while (entry)
+	{
+		if (entry->d_name[0] != '.')
+			count++;
+		entry = readdir(dir);
+	}
+	closedir(dir);
+	return (count - 1);
+}
+
+// "true & true & ... & wait ; echo $? > out"
+static char	*job_fanout(int jobs)
+{
+	char	*line;
+	size_t	len;
+	int		i;
+
+	line = malloc(jobs * 7 + 32);
+	if (!line)
+		return (NULL);
+	len = 0;
+	i = 0;
+	while (i < jobs)
+	{
+		ft_memcpy(line + len, "true & ", 7);
+		len += 7;
+		i++;
+	}
+	ft_memcpy(line + len, "wait ; echo $? > out", 21);
+	return (line);
+}
+
+static char	*read_file(char *path)
+{
+	static char	buf[256];
+	int			fd;
+	ssize_t		n;
+
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return (NULL);
+	n = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (n < 0)
+		return (NULL);
+	buf[n] = '\0';
+	return (buf);
+}
+
+// Runs the line with stderr captured in ./err
+static int	execute_captured(t_ast_node *ast, t_shell *shell, char *expected)
+{
+	char	*err;
+	int		saved;
+	int		fd;
+	int		status;
+
+	saved = dup(STDERR_FILENO);
+	fd = open("err", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	dup2(fd, STDERR_FILENO);
+	close(fd);
+	status = execute_ast(ast, shell);
+	dup2(saved, STDERR_FILENO);
+	close(saved);
+	err = read_file("err");
+	unlink("err");
+	if (!err || !strstr(err, expected))
+	{
+		ft_printf("  %s✗ FAIL:%s stderr '%s'\n", RED, RESET, err ? err : "NULL");
+		return (-1);
+	}
+	return (status);
+}
+
+static long	elapsed_ms(struct timespec *start)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((now.tv_sec - start->tv_sec) * 1000
+		+ (now.tv_nsec - start->tv_nsec) / 1000000);
+}
+
+static int	run_jobs_test(t_jobs_test *test, t_shell *shell)
+{
+	struct timespec	start;
+	t_token			*tokens;
+	t_ast_node		*ast;
+	char			*line;
+	char			*content;
+	int				fds_before;
+	long			ms;
+	int				passed;
+
+	ft_printf("%s=== Test: %s ===%s\n", BOLD, test->desc, RESET);
+	line = test->input;
+	if (line)
+		ft_printf("%sInput:%s '%s'\n", YELLOW, RESET, line);
+	else
+	{
+		line = job_fanout(test->jobs);
+		ft_printf("%sInput:%s true & ... (%d jobs) & wait ; echo $? > out\n",
+			YELLOW, RESET, test->jobs);
+	}
+	unlink("out");
+	fds_before = count_open_fds();
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	tokens = lexer(line);
+	ast = parse(tokens);
+	passed = 0;
+	if (ast && collect_heredocs(ast, shell) && expand_ast(ast, shell))
+	{
+		if (test->expected_err)
+			shell->exit_status = execute_captured(ast, shell, test->expected_err);
+		else
+			shell->exit_status = execute_ast(ast, shell);
+		ms = elapsed_ms(&start);
+		content = read_file("out");
+		passed = (shell->exit_status != -1 && content && ft_strcmp(content, test->expected_out) == 0
+				&& (!test->max_ms || ms <= test->max_ms)
+				&& ms >= test->min_ms);
+		if (!passed)
+			ft_printf("  %s✗ FAIL:%s out '%s' in %ld ms\n",
+				RED, RESET, content ? content : "NULL", ms);
+	}
+	else
+		ft_printf("  %s✗ FAIL:%s Could not prepare AST\n", RED, RESET);
+	ast_free(ast);
+	token_lstclear(&tokens);
+	if (passed && (shell->jobs || count_open_fds() != fds_before))
+	{
+		ft_printf("  %s✗ FAIL:%s jobs left or descriptors leaked\n",
+			RED, RESET);
+		passed = 0;
+	}
+	if (passed)
+		ft_printf("  %s✓ PASS:%s Output matches\n", GREEN, RESET);
+	if (line != test->input)
+		free(line);
+	ft_printf("\n");
+	return (passed);
+}
+
+int	main(int ac, char **av, char **envp)
+{
+	t_shell	shell;
+	char	dir[] = "/tmp/minishell_jobs_XXXXXX";
+	int		fanout;
+	int		fd;
+
+	fanout = 1000;
+	if (ac > 1)
+		fanout = ft_atoi(av[1]);
+	if (!mkdtemp(dir) || chdir(dir) == -1)
+		return (1);
+	ft_memset(&shell, 0, sizeof(t_shell));
+	init_shell(envp, &shell);
+	fd = open("in", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	write(fd, "a\nb\n", 4);
+	close(fd);
+
+	t_jobs_test tests[] = {
+		{
+			.input = "echo a > out ; echo b >> out",
+			.desc = "Semicolon runs both commands in order",
+			.expected_out = "a\nb\n"
+		},
+		{
+			.input = "sh -c 'exit 1' && echo no > out || echo yes > out",
+			.desc = "&& skips after a failure, || runs",
+			.expected_out = "yes\n"
+		},
+		{
+			.input = "sh -c 'exit 3' ; echo $? > out",
+			.desc = "$? is expanded after the previous member ran",
+			.expected_out = "3\n"
+		},
+		{
+			.input = "sh -c 'exit 7' & wait $! ; echo $? > out",
+			.desc = "wait $! returns the status of the job",
+			.expected_out = "7\n"
+		},
+		{
+			.input = "wait -n ; echo $? > out",
+			.desc = "wait -n without jobs returns 127",
+			.expected_out = "127\n"
+		},
+		{
+			.input = "sh -c 'exit 4' & sh -c 'sleep 0.2' & wait -n ; echo $? > out ; wait",
+			.desc = "wait -n returns the first job to finish",
+			.expected_out = "4\n"
+		},
+		{
+			.input = "sleep 0.3 & sleep 0.3 & sleep 0.3 & wait ; echo done > out",
+			.desc = "Background jobs run concurrently",
+			.expected_out = "done\n",
+			.max_ms = 550
+		},
+		{
+			.input = "sleep 0.1 && echo and-list > out & wait",
+			.desc = "Background and-or list runs in a subshell",
+			.expected_out = "and-list\n"
+		},
+		{
+			.input = "echo builtin > out & wait",
+			.desc = "Background builtin runs in a child",
+			.expected_out = "builtin\n"
+		},
+		{
+			.input = "pmap -k -j 3 sh -c 'sleep 0.$1; echo $1' _ {} ::: 3 1 2 > out",
+			.desc = "pmap -k prints outputs in input order",
+			.expected_out = "3\n1\n2\n"
+		},
+		{
+			.input = "pmap -k echo x{}y < in > out",
+			.desc = "pmap reads items from stdin and substitutes {}",
+			.expected_out = "xay\nxby\n"
+		},
+		{
+			.input = "pmap sh -c 'exit $1' _ ::: 0 3 0 ; echo $? > out",
+			.desc = "pmap returns 123 when a run fails",
+			.expected_out = "123\n"
+		},
+		{
+			.input = "pmap -j 4 sleep ::: 0.3 0.3 0.3 0.3 ; echo done > out",
+			.desc = "pmap runs items concurrently up to -j",
+			.expected_out = "done\n",
+			.max_ms = 550
+		},
+		{
+			.input = "pmap -j 2 sleep ::: 0.2 0.2 0.2 0.2 ; echo done > out",
+			.desc = "pmap never runs more than -j items",
+			.expected_out = "done\n",
+			.min_ms = 380
+		},
+		{
+			.input = "time -sj sh -c 'exit 3' | cat ; echo $PIPESTATUS > out",
+			.desc = "time -sj reports each stage as JSON",
+			.expected_out = "3 0\n",
+			.expected_err = "\"stages\":[{\"cmd\":\"sh -c exit 3\""
+		},
+		{
+			.input = "time -p sleep 0.2 > out",
+			.desc = "time -p prints the POSIX report",
+			.expected_out = "",
+			.expected_err = "real 0.2",
+			.min_ms = 200
+		},
+		{
+			.input = "time -x true ; echo $? > out",
+			.desc = "time rejects an unknown option with 2",
+			.expected_out = "2\n",
+			.expected_err = "-x: invalid option"
+		},
+		{
+			.input = "time sh -c 'exit 4' & wait $! ; echo $? > out",
+			.desc = "Background time reports from its subshell",
+			.expected_out = "4\n",
+			.expected_err = "\nreal\t0m0."
+		},
+		{
+			.input = "bench -n 2 -- 'echo a | tr a b' > out",
+			.desc = "bench parses a quoted pipeline and runs it -n times",
+			.expected_out = "b\nb\n",
+			.expected_err = "bench: 'echo a | tr a b': 2 runs, 0 warmup\n  min "
+		},
+		{
+			.input = "bench -w 1 -n 2 -- echo x > out",
+			.desc = "bench warmup runs are executed but not measured",
+			.expected_out = "x\nx\nx\n",
+			.expected_err = "2 runs, 1 warmup"
+		},
+		{
+			.input = "bench -- 'true ; true' ; echo $? > out",
+			.desc = "bench refuses a list",
+			.expected_out = "2\n",
+			.expected_err = "only a pipeline can be measured"
+		},
+		{
+			.input = NULL,
+			.jobs = fanout,
+			.desc = "Fan out many jobs and wait for all of them",
+			.expected_out = "0\n"
+		}
+	};
+
+	int num_tests = sizeof(tests) / sizeof(tests[0]);
+	int passed = 0;
+	int failed = 0;
+	ft_printf("%s╔═══════════════════════════════════════════════╗%s\n", CYAN, RESET);
+	ft_printf("%s║   MINISHELL JOBS AND LISTS TEST SUITE         ║%s\n", CYAN, RESET);
+	ft_printf("%s╚═══════════════════════════════════════════════╝%s\n", CYAN, RESET);
+	for (int i = 0; i < num_tests; i++)
+	{
+		if (run_jobs_test(&tests[i], &shell))
+			passed++;
+		else
+			failed++;
+	}
+	unlink("in");
+	unlink("out");
+	chdir("/");
+	rmdir(dir);
+	jobs_clear(&shell);
+	waitset_free(&shell.children);
+	free(shell.pipestatus);
+	env_free(&shell);
+	ft_printf("%s════════════════ RESULTS ═══════════════════%s\n", BOLD, RESET);
+	ft_printf("Total tests: %d\n", num_tests);
+	ft_printf("Passed: %s%d%s\n", GREEN, passed, RESET);
+	ft_printf("Failed: %s%d%s\n", failed > 0 ? RED : GREEN, failed, RESET);
+	if (failed == 0)
+		ft_printf("\n%s🎉 ALL TESTS PASSED! 🎉%s\n", GREEN, RESET);
+	else
+		ft_printf("\n%s⚠️  SOME TESTS FAILED ⚠️%s\n", YELLOW, RESET);
+	return (failed != 0);
+}
@@ -55,7 +55,7 @@ static int compare_token(t_token *actual, t_token_type exp_type,
 // Colorized token_print
 static void token_print_colored(t_token *token)
 {
-    const char *type_str[8] = {
+    const char *type_str[13] = {
         [TOKEN_EOF] = "EOF",
         [TOKEN_WORD] = "WORD",
         [TOKEN_VAR] = "VAR",
@@ -63,7 +63,12 @@ static void token_print_colored(t_token *token)
         [TOKEN_REDIR_IN] = "REDIR_IN",
         [TOKEN_REDIR_OUT] = "REDIR_OUT",
         [TOKEN_REDIR_APPEND] = "REDIR_APPEND",
-        [TOKEN_HEREDOC] = "HEREDOC"
+        [TOKEN_HEREDOC] = "HEREDOC",
+        [TOKEN_HERESTRING] = "HERESTRING",
+        [TOKEN_AND_IF] = "AND_IF",
+        [TOKEN_OR_IF] = "OR_IF",
+        [TOKEN_SEMI] = "SEMI",
+        [TOKEN_AMP] = "AMP"
     };
     const char *color = CYAN;
     
@@ -263,13 +268,12 @@ int main(int ac, char **av, char **envp)
         {
             .input = "|||",
             .expected = (t_expected_token[]){
-                {TOKEN_PIPE, "|", 0},
-                {TOKEN_PIPE, "|", 0},
+                {TOKEN_OR_IF, "||", 0},
                 {TOKEN_PIPE, "|", 0},
                 {TOKEN_EOF, NULL, 0}
             },
             .expect_error = 0,
-            .desc = "Three consecutive pipes"
+            .desc = "Three consecutive pipes (|| then |)"
         },
         {
             .input = "ls | | grep",
@@ -372,12 +376,32 @@ int main(int ac, char **av, char **envp)
         {
             .input = "<<<",
             .expected = (t_expected_token[]){
-                {TOKEN_HEREDOC, "<<", 0},
+                {TOKEN_HERESTRING, "<<<", 0},
+                {TOKEN_EOF, NULL, 0}
+            },
+            .expect_error = 0,
+            .desc = "Triple < tokenizes as herestring"
+        },
+        {
+            .input = "cat<<<word",
+            .expected = (t_expected_token[]){
+                {TOKEN_WORD, "cat", 0},
+                {TOKEN_HERESTRING, "<<<", 0},
+                {TOKEN_WORD, "word", 0},
+                {TOKEN_EOF, NULL, 0}
+            },
+            .expect_error = 0,
+            .desc = "Herestring no spaces"
+        },
+        {
+            .input = "<<<<",
+            .expected = (t_expected_token[]){
+                {TOKEN_HERESTRING, "<<<", 0},
                 {TOKEN_REDIR_IN, "<", 0},
                 {TOKEN_EOF, NULL, 0}
             },
             .expect_error = 0,
-            .desc = "Triple < tokenizes as heredoc + input"
+            .desc = "Quadruple < tokenizes as herestring + input"
         },
         {
             .input = ">>>",
@@ -686,12 +710,39 @@ int main(int ac, char **av, char **envp)
             .input = "echo ; ls",
             .expected = (t_expected_token[]){
                 {TOKEN_WORD, "echo", 0},
-                {TOKEN_WORD, ";", 0},
+                {TOKEN_SEMI, ";", 0},
                 {TOKEN_WORD, "ls", 0},
                 {TOKEN_EOF, NULL, 0}
             },
             .expect_error = 0,
-            .desc = "Semicolon is a word (not special)"
+            .desc = "Semicolon separates commands"
+        },
+        {
+            .input = "make&&./run||echo failed&",
+            .expected = (t_expected_token[]){
+                {TOKEN_WORD, "make", 0},
+                {TOKEN_AND_IF, "&&", 0},
+                {TOKEN_WORD, "./run", 0},
+                {TOKEN_OR_IF, "||", 0},
+                {TOKEN_WORD, "echo", 0},
+                {TOKEN_WORD, "failed", 0},
+                {TOKEN_AMP, "&", 0},
+                {TOKEN_EOF, NULL, 0}
+            },
+            .expect_error = 0,
+            .desc = "List operators without spaces"
+        },
+        {
+            .input = "a &&& b",
+            .expected = (t_expected_token[]){
+                {TOKEN_WORD, "a", 0},
+                {TOKEN_AND_IF, "&&", 0},
+                {TOKEN_AMP, "&", 0},
+                {TOKEN_WORD, "b", 0},
+                {TOKEN_EOF, NULL, 0}
+            },
+            .expect_error = 0,
+            .desc = "&&& is && then &"
         },
         {
             .input = "echo hello\\world",
@@ -1317,13 +1368,13 @@ int main(int ac, char **av, char **envp)
             .input = "echo ; ; ;",
             .expected = (t_expected_token[]){
                 {TOKEN_WORD, "echo", 0},
-                {TOKEN_WORD, ";", 0},
-                {TOKEN_WORD, ";", 0},
-                {TOKEN_WORD, ";", 0},
+                {TOKEN_SEMI, ";", 0},
+                {TOKEN_SEMI, ";", 0},
+                {TOKEN_SEMI, ";", 0},
                 {TOKEN_EOF, NULL, 0}
             },
             .expect_error = 0,
-            .desc = "Multiple semicolons (treated as words)"
+            .desc = "Multiple semicolons (lexer does not validate)"
         },
         {
             .input = "echo \\| \\> \\< \\&",
@@ -1335,7 +1386,8 @@ int main(int ac, char **av, char **envp)
                 {TOKEN_REDIR_OUT, ">", 0},
                 {TOKEN_WORD, "\\", 0},
                 {TOKEN_REDIR_IN, "<", 0},
-                {TOKEN_WORD, "\\&", 0},
+                {TOKEN_WORD, "\\", 0},
+                {TOKEN_AMP, "&", 0},
                 {TOKEN_EOF, NULL, 0}
             },
             .expect_error = 0,
@@ -29,6 +29,7 @@ typedef struct s_parser_test {
 	t_expected_arg		*expected_args;		// NULL-terminated
 	t_expected_redir	*expected_redirs;	// NULL-terminated
 	int					is_pipeline;		// 1 if expecting PIPE node
+	t_node_type			list_type;			// Expected list root (AND, OR, LIST...)
 } t_parser_test;
 
 // Count args in AST node
@@ -238,6 +239,15 @@ static int run_parser_test(t_parser_test *test, int test_num)
 			ft_printf("  %s✗ FAIL:%s Expected AST but got NULL\n", RED, RESET);
 			passed = 0;
 		}
+		else if (test->list_type)
+		{
+			passed = (ast->type == test->list_type);
+			if (passed)
+				ft_printf("  %s✓ PASS:%s List AST created\n", GREEN, RESET);
+			else
+				ft_printf("  %s✗ FAIL:%s Expected node %d, got %d\n", RED, RESET,
+						test->list_type, ast->type);
+		}
 		else if (test->is_pipeline)
 		{
 			if (ast->type == NODE_PIPE)
@@ -595,6 +605,20 @@ int main(void)
 			},
 			.is_pipeline = 0
 		},
+		{
+			.input = "cat <<< 'hello world'",
+			.expect_error = 0,
+			.desc = "Herestring quoted word",
+			.expected_args = (t_expected_arg[]){
+				{"cat", 0},
+				{NULL, 0}
+			},
+			.expected_redirs = (t_expected_redir[]){
+				{NODE_HERESTRING, "hello world", 1},
+				{0, NULL, 0}
+			},
+			.is_pipeline = 0
+		},
 		{
 			.input = "cat < in.txt > out.txt",
 			.expect_error = 0,
@@ -768,6 +792,94 @@ int main(void)
 			.is_pipeline = 0
 		},
 
+		// ========== LISTS (&&, ||, ;, &) ==========
+		{
+			.input = "make && ./run || echo failed",
+			.expect_error = 0,
+			.desc = "And-or list is left-associative (OR at the root)",
+			.list_type = NODE_OR
+		},
+		{
+			.input = "cc a.c & cc b.c & wait",
+			.expect_error = 0,
+			.desc = "Background jobs then wait",
+			.list_type = NODE_LIST
+		},
+		{
+			.input = "sleep 1 | cat &",
+			.expect_error = 0,
+			.desc = "Trailing & makes a background pipeline",
+			.list_type = NODE_BACKGROUND
+		},
+		{
+			.input = "echo done ;",
+			.expect_error = 0,
+			.desc = "Trailing semicolon is allowed",
+			.expected_args = (t_expected_arg[]){
+				{"echo", 0},
+				{"done", 0},
+				{NULL, 0}
+			},
+			.expected_redirs = NULL,
+			.is_pipeline = 0
+		},
+		{
+			.input = "; ls",
+			.expect_error = 1,
+			.desc = "ERROR: Semicolon at start",
+		},
+
+		// ========== TIME ==========
+		{
+			.input = "time -p cat in | wc -l",
+			.expect_error = 0,
+			.desc = "time wraps the whole pipeline",
+			.list_type = NODE_TIME
+		},
+		{
+			.input = "time make && echo ok",
+			.expect_error = 0,
+			.desc = "time binds tighter than &&",
+			.list_type = NODE_AND
+		},
+		{
+			.input = "'time' ls",
+			.expect_error = 0,
+			.desc = "Quoted time is a plain command",
+			.expected_args = (t_expected_arg[]){
+				{"time", 1},
+				{"ls", 0},
+				{NULL, 0}
+			},
+			.expected_redirs = NULL,
+			.is_pipeline = 0
+		},
+		{
+			.input = "time | cat",
+			.expect_error = 1,
+			.desc = "ERROR: time without a pipeline before |",
+		},
+		{
+			.input = "ls &&",
+			.expect_error = 1,
+			.desc = "ERROR: && at end",
+		},
+		{
+			.input = "ls ; ; ls",
+			.expect_error = 1,
+			.desc = "ERROR: Empty command between semicolons",
+		},
+		{
+			.input = "ls | && wc",
+			.expect_error = 1,
+			.desc = "ERROR: Pipe followed by &&",
+		},
+		{
+			.input = "cat > ;",
+			.expect_error = 1,
+			.desc = "ERROR: Redirect followed by semicolon",
+		},
+
 		// ========== UNCLOSED QUOTES (LEXER ERRORS) ==========
 		{
 			.input = "echo 'unclosed",
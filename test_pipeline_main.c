@@ -0,0 +1,244 @@
+#include "includes/minishell.h"
+#include <stdio.h>
+#include <dirent.h>
+#include <sys/resource.h>
+
+// ANSI Colors
+#define GREEN   "\033[32m"
+#define RED     "\033[31m"
+#define YELLOW  "\033[33m"
+#define CYAN    "\033[36m"
+#define BOLD    "\033[1m"
+#define RESET   "\033[0m"
+
+// Descriptor limit the whole suite runs under
+#define FD_LIMIT 256
+
+typedef struct s_pipeline_test {
+	char	*input;          // Command line, or NULL to generate a cat chain
+	int		stages;          // Length of the generated cat chain
+	char	*desc;
+	char	*expected_out;   // Expected content of ./out
+	int		exit_status;     // Expected exit status
+} t_pipeline_test;
+
+static int	count_open_fds(void)
+{
+	DIR				*dir;
+	struct dirent	*entry;
+	int				count;
+
+	dir = opendir("/proc/self/fd");
+	if (!dir)
+		return (-1);
+	count = 0;
+	entry = readdir(dir);
+	while (entry)
+	{
+		if (entry->d_name[0] != '.')
+			count++;
+		entry = readdir(dir);
+	}
+	closedir(dir);
+	return (count - 1);
+}
+
+// "cat < in | cat | ... | cat > out" with the given number of stages
+static char	*cat_chain(int stages)
+{
+	char	*line;
+	size_t	len;
+	int		i;
+
+	line = malloc(stages * 6 + 16);
+	if (!line)
+		return (NULL);
+	ft_memcpy(line, "cat < in", 8);
+	len = 8;
+	i = 1;
+	while (i < stages)
+	{
+		ft_memcpy(line + len, " | cat", 6);
+		len += 6;
+		i++;
+	}
+	ft_memcpy(line + len, " > out", 7);
+	return (line);
+}
+
+static char	*read_file(char *path)
+{
+	static char	buf[256];
+	int			fd;
+	ssize_t		n;
+
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return (NULL);
+	n = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (n < 0)
+		return (NULL);
+	buf[n] = '\0';
+	return (buf);
+}
+
+static int	run_pipeline_test(t_pipeline_test *test, t_shell *shell)
+{
+	t_token		*tokens;
+	t_ast_node	*ast;
+	char		*line;
+	char		*content;
+	int			fds_before;
+	int			status;
+	int			passed;
+
+	ft_printf("%s=== Test: %s ===%s\n", BOLD, test->desc, RESET);
+	line = test->input;
+	if (line)
+		ft_printf("%sInput:%s '%s'\n", YELLOW, RESET, line);
+	else
+	{
+		line = cat_chain(test->stages);
+		ft_printf("%sInput:%s cat < in | cat | ... (%d stages) > out\n",
+			YELLOW, RESET, test->stages);
+	}
+	unlink("out");
+	fds_before = count_open_fds();
+	tokens = lexer(line);
+	ast = parse(tokens);
+	passed = 0;
+	if (ast && collect_heredocs(ast, shell) && expand_ast(ast, shell))
+	{
+		status = execute_ast(ast, shell);
+		content = read_file("out");
+		passed = (status == test->exit_status && content
+				&& ft_strcmp(content, test->expected_out) == 0);
+		if (!passed)
+			ft_printf("  %s✗ FAIL:%s status %d (expected %d), out '%s'\n",
+				RED, RESET, status, test->exit_status,
+				content ? content : "NULL");
+	}
+	else
+		ft_printf("  %s✗ FAIL:%s Could not prepare AST\n", RED, RESET);
+	ast_free(ast);
+	token_lstclear(&tokens);
+	if (passed && count_open_fds() != fds_before)
+	{
+		ft_printf("  %s✗ FAIL:%s descriptors leaked: %d before, %d after\n",
+			RED, RESET, fds_before, count_open_fds());
+		passed = 0;
+	}
+	if (passed)
+		ft_printf("  %s✓ PASS:%s Output and status match\n", GREEN, RESET);
+	if (line != test->input)
+		free(line);
+	ft_printf("\n");
+	return (passed);
+}
+
+int	main(int ac, char **av, char **envp)
+{
+	t_shell			shell;
+	struct rlimit	limit;
+	char			dir[] = "/tmp/minishell_pipe_XXXXXX";
+	int				stress_stages;
+	int				fd;
+
+	stress_stages = 10000;
+	if (ac > 1)
+		stress_stages = ft_atoi(av[1]);
+	limit.rlim_cur = FD_LIMIT;
+	limit.rlim_max = FD_LIMIT;
+	if (setrlimit(RLIMIT_NOFILE, &limit) == -1
+		|| !mkdtemp(dir) || chdir(dir) == -1)
+		return (1);
+	ft_memset(&shell, 0, sizeof(t_shell));
+	init_shell(envp, &shell);
+	fd = open("in", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	write(fd, "through the chain\n", 18);
+	close(fd);
+
+	t_pipeline_test tests[] = {
+		{
+			.input = "cat < in | cat > out",
+			.desc = "Two stages",
+			.expected_out = "through the chain\n",
+			.exit_status = 0
+		},
+		{
+			.input = "cat < in | tr a-z A-Z | cat > out",
+			.desc = "Three stages transform data",
+			.expected_out = "THROUGH THE CHAIN\n",
+			.exit_status = 0
+		},
+		{
+			.input = "cat < missing | echo still runs > out",
+			.desc = "Failing redirect only stops its own stage",
+			.expected_out = "still runs\n",
+			.exit_status = 0
+		},
+		{
+			.input = "echo last > out | nosuchcommand",
+			.desc = "Status comes from the last stage",
+			.expected_out = "last\n",
+			.exit_status = 127
+		},
+		{
+			.input = "sh -c 'exit 3' | sh -c 'exit 5' | cat > out",
+			.desc = "Every stage is reaped, status of the last one wins",
+			.expected_out = "",
+			.exit_status = 0
+		},
+		{
+			.input = "echo $PIPESTATUS > out",
+			.desc = "PIPESTATUS holds the statuses of the previous pipeline",
+			.expected_out = "3 5 0\n",
+			.exit_status = 0
+		},
+		{
+			.input = NULL,
+			.stages = 1000,
+			.desc = "1,000-stage cat chain",
+			.expected_out = "through the chain\n",
+			.exit_status = 0
+		},
+		{
+			.input = NULL,
+			.stages = stress_stages,
+			.desc = "Stress: wide cat chain under a 256-descriptor limit",
+			.expected_out = "through the chain\n",
+			.exit_status = 0
+		}
+	};
+
+	int num_tests = sizeof(tests) / sizeof(tests[0]);
+	int passed = 0;
+	int failed = 0;
+	ft_printf("%s╔═══════════════════════════════════════════════╗%s\n", CYAN, RESET);
+	ft_printf("%s║   MINISHELL PIPELINE TEST SUITE               ║%s\n", CYAN, RESET);
+	ft_printf("%s╚═══════════════════════════════════════════════╝%s\n", CYAN, RESET);
+	for (int i = 0; i < num_tests; i++)
+	{
+		if (run_pipeline_test(&tests[i], &shell))
+			passed++;
+		else
+			failed++;
+	}
+	unlink("in");
+	unlink("out");
+	chdir("/");
+	rmdir(dir);
+	waitset_free(&shell.children);
+	free(shell.pipestatus);
+	env_free(&shell);
+	ft_printf("%s════════════════ RESULTS ═══════════════════%s\n", BOLD, RESET);
+	ft_printf("Total tests: %d\n", num_tests);
+	ft_printf("Passed: %s%d%s\n", GREEN, passed, RESET);
+	ft_printf("Failed: %s%d%s\n", failed > 0 ? RED : GREEN, failed, RESET);
+	if (failed == 0)
+		ft_printf("\n%s🎉 ALL TESTS PASSED! 🎉%s\n", GREEN, RESET);
+	else
+		ft_printf("\n%s⚠️  SOME TESTS FAILED ⚠️%s\n", YELLOW, RESET);
+	return (failed != 0);
+}
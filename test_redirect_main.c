@@ -0,0 +1,313 @@
+#define _GNU_SOURCE
+#include "includes/minishell.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <sys/mman.h>
+
+// ANSI Colors
+#define GREEN   "\033[32m"
+#define RED     "\033[31m"
+#define YELLOW  "\033[33m"
+#define CYAN    "\033[36m"
+#define BOLD    "\033[1m"
+#define RESET   "\033[0m"
+
+/*
+** Syscall counters, shared with the forked children so the dup2/close
+** calls made between fork() and execve() are counted too.
+** Built with -Wl,--wrap=... (see the test_redirect target).
+*/
+typedef struct s_sys_count {
+	int	open;
+	int	close;
+	int	dup2;
+	int	close_range;
+	int	fork;
+	int	fcntl;
+} t_sys_count;
+
+typedef struct s_redirect_test {
+	char		*input;
+	char		*desc;
+	t_sys_count	expected;
+	char		*out_file;       // File to check after running, or NULL
+	char		*out_content;    // Expected content of out_file
+	int			exit_status;     // Expected exit status
+} t_redirect_test;
+
+static t_sys_count	*g_count;
+
+int	__real_open(const char *path, int flags, ...);
+int	__real_close(int fd);
+int	__real_dup2(int oldfd, int newfd);
+int	__real_close_range(unsigned int first, unsigned int last, int flags);
+pid_t	__real_fork(void);
+int	__real_fcntl(int fd, int cmd, ...);
+
+int	__wrap_open(const char *path, int flags, ...)
+{
+	va_list	ap;
+	mode_t	mode;
+
+	mode = 0;
+	if (flags & O_CREAT)
+	{
+		va_start(ap, flags);
+		mode = va_arg(ap, mode_t);
+		va_end(ap);
+	}
+	g_count->open++;
+	return (__real_open(path, flags, mode));
+}
+
+int	__wrap_close(int fd)
+{
+	g_count->close++;
+	return (__real_close(fd));
+}
+
+int	__wrap_dup2(int oldfd, int newfd)
+{
+	g_count->dup2++;
+	return (__real_dup2(oldfd, newfd));
+}
+
+int	__wrap_close_range(unsigned int first, unsigned int last, int flags)
+{
+	g_count->close_range++;
+	return (__real_close_range(first, last, flags));
+}
+
+pid_t	__wrap_fork(void)
+{
+	g_count->fork++;
+	return (__real_fork());
+}
+
+int	__wrap_fcntl(int fd, int cmd, ...)
+{
+	va_list	ap;
+	long	arg;
+
+	va_start(ap, cmd);
+	arg = va_arg(ap, long);
+	va_end(ap);
+	g_count->fcntl++;
+	return (__real_fcntl(fd, cmd, arg));
+}
+
+static char	*read_file(char *path)
+{
+	static char	buf[256];
+	int			fd;
+	ssize_t		n;
+
+	fd = __real_open(path, O_RDONLY);
+	if (fd == -1)
+		return (NULL);
+	n = read(fd, buf, sizeof(buf) - 1);
+	__real_close(fd);
+	if (n < 0)
+		return (NULL);
+	buf[n] = '\0';
+	return (buf);
+}
+
+static int	check_count(char *name, int expected, int got)
+{
+	if (expected == got)
+		return (1);
+	ft_printf("  %s✗ %s count mismatch:%s expected %d, got %d\n",
+		RED, name, RESET, expected, got);
+	return (0);
+}
+
+static int	check_counts(t_sys_count *exp, t_sys_count *got)
+{
+	int	ok;
+
+	ok = check_count("open", exp->open, got->open);
+	ok &= check_count("close", exp->close, got->close);
+	ok &= check_count("dup2", exp->dup2, got->dup2);
+	ok &= check_count("close_range", exp->close_range, got->close_range);
+	ok &= check_count("fork", exp->fork, got->fork);
+	ok &= check_count("fcntl", exp->fcntl, got->fcntl);
+	return (ok);
+}
+
+static int	run_redirect_test(t_redirect_test *test, t_shell *shell)
+{
+	t_token		*tokens;
+	t_ast_node	*ast;
+	int			status;
+	int			passed;
+	char		*content;
+
+	ft_printf("%s=== Test: %s ===%s\n", BOLD, test->desc, RESET);
+	ft_printf("%sInput:%s '%s'\n", YELLOW, RESET, test->input);
+	tokens = lexer(test->input);
+	ast = parse(tokens);
+	if (!ast || !collect_heredocs(ast, shell) || !expand_ast(ast, shell))
+	{
+		ft_printf("  %s✗ FAIL:%s Could not prepare AST\n", RED, RESET);
+		ast_free(ast);
+		token_lstclear(&tokens);
+		return (0);
+	}
+	ft_memset(g_count, 0, sizeof(t_sys_count));
+	status = execute_ast(ast, shell);
+	passed = check_counts(&test->expected, g_count);
+	if (status != test->exit_status)
+	{
+		ft_printf("  %s✗ Exit status mismatch:%s expected %d, got %d\n",
+			RED, RESET, test->exit_status, status);
+		passed = 0;
+	}
+	if (test->out_file)
+	{
+		content = read_file(test->out_file);
+		if (!content || ft_strcmp(content, test->out_content) != 0)
+		{
+			ft_printf("  %s✗ Output mismatch:%s expected '%s', got '%s'\n",
+				RED, RESET, test->out_content, content ? content : "NULL");
+			passed = 0;
+		}
+	}
+	if (passed)
+		ft_printf("  %s✓ PASS:%s Syscall counts match\n", GREEN, RESET);
+	ft_printf("\n");
+	ast_free(ast);
+	token_lstclear(&tokens);
+	return (passed);
+}
+
+int	main(int ac, char **av, char **envp)
+{
+	t_shell		shell;
+	char		dir[] = "/tmp/minishell_redir_XXXXXX";
+	int			passed;
+	int			failed;
+	int			fd;
+
+	(void)ac;
+	(void)av;
+	g_count = mmap(NULL, sizeof(t_sys_count), PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (g_count == MAP_FAILED || !mkdtemp(dir) || chdir(dir) == -1)
+		return (1);
+	ft_memset(&shell, 0, sizeof(t_shell));
+	init_shell(envp, &shell);
+	fd = __real_open("in", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	write(fd, "input data\n", 11);
+	__real_close(fd);
+
+	// Parent: opens (1 per redirect), closes its copies after fork,
+	// then closes the child's pidfd once it has been reaped.
+	// Child: one dup2 per redirected stream and a single close_range.
+	t_redirect_test tests[] = {
+		{
+			.input = "/bin/cat < in > out",
+			.desc = "External command, in and out redirected",
+			.expected = {.open = 2, .close = 3, .dup2 = 2,
+				.close_range = 1, .fork = 1, .fcntl = 0},
+			.out_file = "out",
+			.out_content = "input data\n",
+			.exit_status = 0
+		},
+		{
+			.input = "/bin/cat < in > first > out",
+			.desc = "Overridden output is closed, never dup'd",
+			.expected = {.open = 3, .close = 4, .dup2 = 2,
+				.close_range = 1, .fork = 1, .fcntl = 0},
+			.out_file = "out",
+			.out_content = "input data\n",
+			.exit_status = 0
+		},
+		{
+			.input = "/bin/cat < in >> out",
+			.desc = "Append redirect",
+			.expected = {.open = 2, .close = 3, .dup2 = 2,
+				.close_range = 1, .fork = 1, .fcntl = 0},
+			.out_file = "out",
+			.out_content = "input data\ninput data\n",
+			.exit_status = 0
+		},
+		{
+			.input = "/bin/cat <<< herestring > out",
+			.desc = "Herestring body is dup'd, not reopened",
+			.expected = {.open = 1, .close = 2, .dup2 = 2,
+				.close_range = 1, .fork = 1, .fcntl = 0},
+			.out_file = "out",
+			.out_content = "herestring\n",
+			.exit_status = 0
+		},
+		{
+			.input = "/bin/cat < missing > out",
+			.desc = "Failing input is detected before forking",
+			.expected = {.open = 1, .close = 0, .dup2 = 0,
+				.close_range = 0, .fork = 0, .fcntl = 0},
+			.out_file = NULL,
+			.out_content = NULL,
+			.exit_status = 1
+		},
+		{
+			.input = "/bin/cat < in > /nonexistent/dir/out",
+			.desc = "Failing output is detected before forking",
+			.expected = {.open = 2, .close = 1, .dup2 = 0,
+				.close_range = 0, .fork = 0, .fcntl = 0},
+			.out_file = NULL,
+			.out_content = NULL,
+			.exit_status = 1
+		},
+		{
+			.input = "echo builtin > out",
+			.desc = "Builtin redirects in the shell and restores stdout",
+			.expected = {.open = 1, .close = 2, .dup2 = 2,
+				.close_range = 0, .fork = 0, .fcntl = 1},
+			.out_file = "out",
+			.out_content = "builtin\n",
+			.exit_status = 0
+		},
+		{
+			.input = "> created",
+			.desc = "Redirection-only command does not fork",
+			.expected = {.open = 1, .close = 1, .dup2 = 0,
+				.close_range = 0, .fork = 0, .fcntl = 0},
+			.out_file = "created",
+			.out_content = "",
+			.exit_status = 0
+		}
+	};
+
+	int num_tests = sizeof(tests) / sizeof(tests[0]);
+	passed = 0;
+	failed = 0;
+	ft_printf("%s╔═══════════════════════════════════════════════╗%s\n", CYAN, RESET);
+	ft_printf("%s║   MINISHELL REDIRECTION SYSCALL TEST SUITE    ║%s\n", CYAN, RESET);
+	ft_printf("%s╚═══════════════════════════════════════════════╝%s\n", CYAN, RESET);
+	for (int i = 0; i < num_tests; i++)
+	{
+		if (run_redirect_test(&tests[i], &shell))
+			passed++;
+		else
+			failed++;
+	}
+	unlink("in");
+	unlink("out");
+	unlink("first");
+	unlink("created");
+	chdir("/");
+	rmdir(dir);
+	waitset_free(&shell.children);
+	free(shell.pipestatus);
+	env_free(&shell);
+	ft_printf("%s════════════════ RESULTS ═══════════════════%s\n", BOLD, RESET);
+	ft_printf("Total tests: %d\n", num_tests);
+	ft_printf("Passed: %s%d%s\n", GREEN, passed, RESET);
+	ft_printf("Failed: %s%d%s\n", failed > 0 ? RED : GREEN, failed, RESET);
+	if (failed == 0)
+		ft_printf("\n%s🎉 ALL TESTS PASSED! 🎉%s\n", GREEN, RESET);
+	else
+		ft_printf("\n%s⚠️  SOME TESTS FAILED ⚠️%s\n", YELLOW, RESET);
+	return (failed != 0);
+}
@@ -0,0 +1,235 @@
+#include "includes/minishell.h"
+#include <stdio.h>
+
+// ANSI Colors
+#define GREEN   "\033[32m"
+#define RED     "\033[31m"
+#define YELLOW  "\033[33m"
+#define CYAN    "\033[36m"
+#define BOLD    "\033[1m"
+#define RESET   "\033[0m"
+
+#define PRELOAD "./test_syscalls_preload.so"
+#define SCRIPT "/tmp/minishell_syscalls.sh"
+#define COUNTS "/tmp/minishell_syscalls.out"
+#define MAX_CALLS 32
+
+/*
+** Each command runs once and three times in a fresh ./minishell under
+** the LD_PRELOAD interposer; half the difference is what one more line
+** of that command costs, startup and exit cancelling out. expected lists
+** every call with a nonzero count, so both an extra call and one that
+** disappears fail the test: update the line along with the change that
+** explains it. A count that depends on timing (how many children one
+** epoll_wait() reports) is written as a range, "name=lo..hi". read and sigaction include readline (one read per byte of
+** the line, its signal handlers set and restored around every prompt);
+** each builtin run in the shell adds the sigaction that lets Ctrl-C
+** interrupt it.
+*/
+typedef struct s_syscall_test {
+	char	*input;
+	char	*desc;
+	char	*expected;
+} t_syscall_test;
+
+typedef struct s_counts {
+	char	names[MAX_CALLS][16];
+	long	values[MAX_CALLS];
+	int		len;
+} t_counts;
+
+extern char	**environ;
+
+static int	run_session(char *line, int repeat, t_counts *c)
+{
+	char	*env[256];
+	FILE	*f;
+	pid_t	pid;
+	int		i;
+	int		fd;
+
+	f = fopen(SCRIPT, "w");
+	if (!f)
+		return (0);
+	i = 0;
+	while (i++ < repeat)
+		fprintf(f, "%s\n", line);
+	fclose(f);
+	i = 0;
+	while (environ[i] && i < 253)
+	{
+		env[i] = environ[i];
+		i++;
+	}
+	env[i++] = "LD_PRELOAD=" PRELOAD;
+	env[i++] = "SYSCOUNT_OUT=" COUNTS;
+	env[i] = NULL;
+	unlink(COUNTS);
+	pid = fork();
+	if (pid == 0)
+	{
+		fd = open(SCRIPT, O_RDONLY);
+		dup2(fd, 0);
+		close(fd);
+		fd = open("/dev/null", O_WRONLY);
+		dup2(fd, 1);
+		dup2(fd, 2);
+		close(fd);
+		execve("./minishell", (char *[]){"./minishell", NULL}, env);
+		_exit(127);
+	}
+	waitpid(pid, NULL, 0);
+	f = fopen(COUNTS, "r");
+	if (!f)
+		return (0);
+	c->len = 0;
+	while (c->len < MAX_CALLS && fscanf(f, "%15s %ld", c->names[c->len],
+			&c->values[c->len]) == 2)
+		c->len++;
+	fclose(f);
+	return (1);
+}
+
+// Formats the nonzero per-line counts as "name=n name=n"
+static void	per_line(t_counts *one, t_counts *three, char *buf, size_t size)
+{
+	size_t	len;
+	long	d;
+	int		i;
+
+	buf[0] = '\0';
+	len = 0;
+	i = 0;
+	while (i < one->len && i < three->len)
+	{
+		d = three->values[i] - one->values[i];
+		if (d % 2)
+			len += snprintf(buf + len, size - len, "%s%s=%ld/2",
+					len ? " " : "", one->names[i], d);
+		else if (d)
+			len += snprintf(buf + len, size - len, "%s%s=%ld",
+					len ? " " : "", one->names[i], d / 2);
+		if (len >= size)
+			break ;
+		i++;
+	}
+}
+
+// Half the difference of the two sessions for name, times two
+static long	twice_per_line(t_counts *one, t_counts *three, char *name)
+{
+	int	i;
+
+	i = 0;
+	while (i < one->len && i < three->len)
+	{
+		if (!strcmp(one->names[i], name))
+			return (three->values[i] - one->values[i]);
+		i++;
+	}
+	return (0);
+}
+
+// Every name=n or name=lo..hi of expected holds and no other call moved
+static int	matches(t_counts *one, t_counts *three, char *expected)
+{
+	char	name[16];
+	long	lo;
+	long	hi;
+	long	d;
+	int		listed;
+	int		n;
+	int		i;
+
+	listed = 0;
+	while (sscanf(expected, " %15[^=]=%ld%n", name, &lo, &n) == 2)
+	{
+		expected += n;
+		hi = lo;
+		if (sscanf(expected, "..%ld%n", &hi, &n) == 1)
+			expected += n;
+		d = twice_per_line(one, three, name);
+		if (d < 2 * lo || d > 2 * hi)
+			return (0);
+		listed += (d != 0);
+	}
+	i = -1;
+	while (++i < one->len && i < three->len)
+		listed -= (three->values[i] != one->values[i]);
+	return (listed == 0);
+}
+
+int	main(void)
+{
+	t_syscall_test	tests[] = {
+		{"true", "builtin, no output",
+			"sigaction=20 signal=1 read=5"},
+		{"echo hi", "builtin writing to stdout",
+			"sigaction=20 signal=1 read=8 write=1"},
+		{"echo hi > /tmp/minishell_syscalls.x", "builtin with redirection",
+			"sigaction=20 signal=1 read=36 write=1 open=1 close=2 dup2=2"},
+		{"cd .", "cd (logical cwd revalidated by one stat)",
+			"sigaction=20 signal=1 read=5 stat=1"},
+		{"export A=1", "export",
+			"sigaction=20 signal=1 read=11"},
+		{"/bin/true", "external command",
+			"sigaction=19 signal=4 read=10 close=1 fork=1 execve=1 waitid=1 "
+			"close_range=1 pidfd_open=1"},
+		{"/bin/true | /bin/true", "two-stage pipeline",
+			"sigaction=19 signal=6 read=22 close=4 dup2=2 pipe2=1 fork=2 "
+			"execve=2 waitid=2 close_range=2 pidfd_open=2 epoll_ctl=4 "
+			"epoll_wait=1..2"},
+		{"true && true", "list of builtins",
+			"sigaction=21 signal=1 read=13"},
+	};
+	t_counts		one;
+	t_counts		three;
+	char			got[512];
+	int				num_tests;
+	int				passed;
+	int				failed;
+	int				ok;
+	int				i;
+
+	if (access(PRELOAD, R_OK) || access("./minishell", X_OK))
+	{
+		ft_printf("%sneeds ./minishell and %s%s\n", RED, PRELOAD, RESET);
+		return (1);
+	}
+	num_tests = sizeof(tests) / sizeof(*tests);
+	passed = 0;
+	failed = 0;
+	ft_printf("%s%s=== SYSCALLS PER LINE ===%s\n\n", BOLD, CYAN, RESET);
+	i = 0;
+	while (i < num_tests)
+	{
+		ok = run_session(tests[i].input, 1, &one)
+			&& run_session(tests[i].input, 3, &three);
+		if (!ok)
+			snprintf(got, sizeof(got), "(no counts written)");
+		else
+			per_line(&one, &three, got, sizeof(got));
+		ft_printf("%sTest %d:%s %s\n", YELLOW, i + 1, RESET, tests[i].desc);
+		ft_printf("  Input:    '%s'\n", tests[i].input);
+		if (ok && matches(&one, &three, tests[i].expected))
+		{
+			ft_printf("  %sPASS%s %s\n\n", GREEN, RESET, got);
+			passed++;
+		}
+		else
+		{
+			ft_printf("  Expected: %s\n", tests[i].expected);
+			ft_printf("  Got:      %s\n", got);
+			ft_printf("  %sFAIL%s\n\n", RED, RESET);
+			failed++;
+		}
+		i++;
+	}
+	unlink(SCRIPT);
+	unlink(COUNTS);
+	unlink("/tmp/minishell_syscalls.x");
+	ft_printf("Total tests: %d\n", num_tests);
+	ft_printf("Passed: %s%d%s\n", GREEN, passed, RESET);
+	ft_printf("Failed: %s%d%s\n", failed > 0 ? RED : GREEN, failed, RESET);
+	return (failed > 0);
+}
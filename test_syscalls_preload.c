@@ -0,0 +1,301 @@
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*
+** LD_PRELOAD interposer for test_syscalls: counts the libc calls that
+** become syscalls in the shell (readline included) and in its forked
+** children until they exec. Raw syscall() calls are counted by number
+** under the same names (the shell reaps through syscall(SYS_waitid)).
+** Counters live in a shared anonymous mapping
+** so the children's dup2/close add up in the parent, which writes them
+** to $SYSCOUNT_OUT as "name count" lines when it exits.
+*/
+
+enum e_cnt {
+	CNT_SIGACTION, CNT_SIGNAL, CNT_READ, CNT_WRITE, CNT_OPEN, CNT_CLOSE,
+	CNT_DUP, CNT_DUP2, CNT_PIPE2, CNT_FORK, CNT_EXECVE, CNT_WAITID,
+	CNT_WAITPID, CNT_STAT, CNT_FSTAT, CNT_LSEEK, CNT_ACCESS, CNT_GETCWD,
+	CNT_CLOSE_RANGE, CNT_PIDFD_OPEN, CNT_EPOLL_CTL, CNT_EPOLL_WAIT,
+	CNT_MEMFD_CREATE, CNT_SPLICE, CNT_COUNT
+};
+
+static const char	*g_names[CNT_COUNT] = {"sigaction", "signal", "read",
+	"write", "open", "close", "dup", "dup2", "pipe2", "fork", "execve",
+	"waitid", "waitpid", "stat", "fstat", "lseek", "access", "getcwd",
+	"close_range", "pidfd_open", "epoll_ctl", "epoll_wait", "memfd_create",
+	"splice"};
+
+static long		*g_counts;
+static pid_t	g_owner;
+
+#define REAL(name) \
+	static __typeof__(name) *real; \
+	if (!real) \
+		real = (__typeof__(name) *)dlsym(RTLD_NEXT, #name)
+
+static void	count(int sys)
+{
+	if (g_counts)
+		__atomic_fetch_add(&g_counts[sys], 1, __ATOMIC_RELAXED);
+}
+
+__attribute__((constructor))
+static void	syscount_init(void)
+{
+	void	*p;
+
+	p = mmap(NULL, sizeof(long) * CNT_COUNT, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (p != MAP_FAILED)
+		g_counts = p;
+	g_owner = getpid();
+}
+
+__attribute__((destructor))
+static void	syscount_dump(void)
+{
+	char	buf[64];
+	char	*path;
+	int		fd;
+	int		len;
+	int		i;
+
+	path = getenv("SYSCOUNT_OUT");
+	if (!g_counts || getpid() != g_owner || !path)
+		return ;
+	fd = syscall(SYS_openat, AT_FDCWD, path, O_WRONLY | O_CREAT | O_TRUNC,
+			0644);
+	if (fd < 0)
+		return ;
+	i = 0;
+	while (i < CNT_COUNT)
+	{
+		len = snprintf(buf, sizeof(buf), "%s %ld\n", g_names[i],
+				g_counts[i]);
+		syscall(SYS_write, fd, buf, len);
+		i++;
+	}
+	syscall(SYS_close, fd);
+}
+
+int	sigaction(int sig, const struct sigaction *act, struct sigaction *old)
+{
+	REAL(sigaction);
+	count(CNT_SIGACTION);
+	return (real(sig, act, old));
+}
+
+sighandler_t	signal(int sig, sighandler_t handler)
+{
+	REAL(signal);
+	count(CNT_SIGNAL);
+	return (real(sig, handler));
+}
+
+ssize_t	read(int fd, void *buf, size_t n)
+{
+	REAL(read);
+	count(CNT_READ);
+	return (real(fd, buf, n));
+}
+
+ssize_t	write(int fd, const void *buf, size_t n)
+{
+	REAL(write);
+	count(CNT_WRITE);
+	return (real(fd, buf, n));
+}
+
+int	open(const char *path, int flags, ...)
+{
+	va_list	ap;
+	mode_t	mode;
+
+	REAL(open);
+	mode = 0;
+	if (flags & O_CREAT)
+	{
+		va_start(ap, flags);
+		mode = va_arg(ap, mode_t);
+		va_end(ap);
+	}
+	count(CNT_OPEN);
+	return (real(path, flags, mode));
+}
+
+int	close(int fd)
+{
+	REAL(close);
+	count(CNT_CLOSE);
+	return (real(fd));
+}
+
+int	dup(int fd)
+{
+	REAL(dup);
+	count(CNT_DUP);
+	return (real(fd));
+}
+
+int	dup2(int fd, int fd2)
+{
+	REAL(dup2);
+	count(CNT_DUP2);
+	return (real(fd, fd2));
+}
+
+int	pipe2(int fds[2], int flags)
+{
+	REAL(pipe2);
+	count(CNT_PIPE2);
+	return (real(fds, flags));
+}
+
+pid_t	fork(void)
+{
+	REAL(fork);
+	count(CNT_FORK);
+	return (real());
+}
+
+int	execve(const char *path, char *const argv[], char *const envp[])
+{
+	REAL(execve);
+	count(CNT_EXECVE);
+	return (real(path, argv, envp));
+}
+
+int	waitid(idtype_t type, id_t id, siginfo_t *info, int options)
+{
+	REAL(waitid);
+	count(CNT_WAITID);
+	return (real(type, id, info, options));
+}
+
+pid_t	waitpid(pid_t pid, int *status, int options)
+{
+	REAL(waitpid);
+	count(CNT_WAITPID);
+	return (real(pid, status, options));
+}
+
+int	stat(const char *path, struct stat *st)
+{
+	REAL(stat);
+	count(CNT_STAT);
+	return (real(path, st));
+}
+
+int	fstat(int fd, struct stat *st)
+{
+	REAL(fstat);
+	count(CNT_FSTAT);
+	return (real(fd, st));
+}
+
+off_t	lseek(int fd, off_t off, int whence)
+{
+	REAL(lseek);
+	count(CNT_LSEEK);
+	return (real(fd, off, whence));
+}
+
+int	access(const char *path, int mode)
+{
+	REAL(access);
+	count(CNT_ACCESS);
+	return (real(path, mode));
+}
+
+char	*getcwd(char *buf, size_t size)
+{
+	REAL(getcwd);
+	count(CNT_GETCWD);
+	return (real(buf, size));
+}
+
+int	close_range(unsigned int first, unsigned int last, int flags)
+{
+	REAL(close_range);
+	count(CNT_CLOSE_RANGE);
+	return (real(first, last, flags));
+}
+
+int	pidfd_open(pid_t pid, unsigned int flags)
+{
+	REAL(pidfd_open);
+	count(CNT_PIDFD_OPEN);
+	return (real(pid, flags));
+}
+
+int	epoll_ctl(int epfd, int op, int fd, struct epoll_event *event)
+{
+	REAL(epoll_ctl);
+	count(CNT_EPOLL_CTL);
+	return (real(epfd, op, fd, event));
+}
+
+int	epoll_wait(int epfd, struct epoll_event *events, int max, int timeout)
+{
+	REAL(epoll_wait);
+	count(CNT_EPOLL_WAIT);
+	return (real(epfd, events, max, timeout));
+}
+
+int	memfd_create(const char *name, unsigned int flags)
+{
+	REAL(memfd_create);
+	count(CNT_MEMFD_CREATE);
+	return (real(name, flags));
+}
+
+ssize_t	splice(int in, loff_t *off_in, int out, loff_t *off_out, size_t len,
+		unsigned int flags)
+{
+	REAL(splice);
+	count(CNT_SPLICE);
+	return (real(in, off_in, out, off_out, len, flags));
+}
+
+/*
+** syscall() takes up to six word-sized arguments; they are all passed
+** on, whatever the call uses.
+*/
+long	syscall(long nr, ...)
+{
+	va_list	ap;
+	long	a[6];
+	int		i;
+
+	REAL(syscall);
+	va_start(ap, nr);
+	i = 0;
+	while (i < 6)
+		a[i++] = va_arg(ap, long);
+	va_end(ap);
+	if (nr == SYS_waitid)
+		count(CNT_WAITID);
+	else if (nr == SYS_pidfd_open)
+		count(CNT_PIDFD_OPEN);
+	else if (nr == SYS_close_range)
+		count(CNT_CLOSE_RANGE);
+	else if (nr == SYS_epoll_wait || nr == SYS_epoll_pwait)
+		count(CNT_EPOLL_WAIT);
+	else if (nr == SYS_memfd_create)
+		count(CNT_MEMFD_CREATE);
+	else if (nr == SYS_splice)
+		count(CNT_SPLICE);
+	return (real(nr, a[0], a[1], a[2], a[3], a[4], a[5]));
+}
@@ -0,0 +1,157 @@
+#include "includes/minishell.h"
+
+/**
+ * time_flags - Parses the options of a `time` node
+ * @args: Option words kept by the parser ("-p", "-s", "-j"...), or NULL
+ * @flags: Receives TIME_POSIX, TIME_STAGES and TIME_JSON
+ *
+ * Options may be grouped ("-sj").
+ *
+ * Returns: 1 on success, 0 on an unknown option (already reported)
+ */
+static int	time_flags(char **args, int *flags)
+{
+	int	i;
+	int	j;
+
+	*flags = 0;
+	i = 0;
+	while (args && args[i])
+	{
+		j = 1;
+		while (args[i][j] == 'p' || args[i][j] == 's' || args[i][j] == 'j')
+		{
+			if (args[i][j] == 'p')
+				*flags |= TIME_POSIX;
+			else if (args[i][j] == 's')
+				*flags |= TIME_STAGES;
+			else
+				*flags |= TIME_JSON;
+			j++;
+		}
+		if (args[i][j])
+		{
+			ft_putstr_fd("minishell: time: ", 2);
+			ft_putstr_fd(args[i], 2);
+			ft_putstr_fd(": invalid option\n", 2);
+			ft_putstr_fd("time: usage: time [-p] [-s] [-j] pipeline\n", 2);
+			return (0);
+		}
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * elapsed - Seconds between two CLOCK_MONOTONIC readings
+ * @start: Earlier reading
+ * @end: Later reading
+ *
+ * Returns: end - start, in seconds
+ */
+static double	elapsed(struct timespec *start, struct timespec *end)
+{
+	return ((end->tv_sec - start->tv_sec)
+		+ (end->tv_nsec - start->tv_nsec) / 1e9);
+}
+
+/**
+ * timing_record - Adds the stages of a reaped foreground job
+ * @timing: Report being filled in
+ * @ws: Wait set holding the stages
+ * @slots: Wait-set slots of the stages, in pipeline order (all reaped)
+ * @n: Number of stages
+ *
+ * Stages are appended, so a report keeps one entry per process even
+ * if it is ever filled by several jobs. On allocation failure the
+ * stages are simply left out of the report.
+ */
+void	timing_record(t_timing *timing, t_waitset *ws, int *slots, int n)
+{
+	t_stage_time	*stages;
+	t_child			*child;
+	int				i;
+
+	stages = malloc(sizeof(t_stage_time) * (timing->count + n));
+	if (!stages)
+		return ;
+	if (timing->count > 0)
+		ft_memcpy(stages, timing->stages,
+			sizeof(t_stage_time) * timing->count);
+	free(timing->stages);
+	timing->stages = stages;
+	i = 0;
+	while (i < n)
+	{
+		child = &ws->slots[slots[i++]];
+		stages[timing->count].pid = child->pid;
+		stages[timing->count].status = child->status;
+		stages[timing->count].real = elapsed(&child->started, &child->ended);
+		stages[timing->count].ru = child->ru;
+		timing->count++;
+	}
+}
+
+/**
+ * self_usage - Time the shell process spent between two readings
+ * @before: getrusage(RUSAGE_SELF) taken before the pipeline
+ * @timing: Report whose self field receives the difference
+ *
+ * Covers builtins, which run inside the shell and have no child to
+ * take an rusage from. Max RSS is the shell's own peak.
+ */
+static void	self_usage(struct rusage *before, t_timing *timing)
+{
+	struct rusage	after;
+
+	if (getrusage(RUSAGE_SELF, &after) == -1)
+		return ;
+	timing->self.ru_utime.tv_sec = after.ru_utime.tv_sec
+		- before->ru_utime.tv_sec;
+	timing->self.ru_utime.tv_usec = after.ru_utime.tv_usec
+		- before->ru_utime.tv_usec;
+	timing->self.ru_stime.tv_sec = after.ru_stime.tv_sec
+		- before->ru_stime.tv_sec;
+	timing->self.ru_stime.tv_usec = after.ru_stime.tv_usec
+		- before->ru_stime.tv_usec;
+	timing->self.ru_maxrss = after.ru_maxrss;
+}
+
+/**
+ * execute_time - Executes a NODE_TIME node
+ * @ast: NODE_TIME node (options in args, expanded pipeline in left)
+ * @shell: Shell context
+ *
+ * The pipeline runs as usual while shell->timing collects its stages.
+ * The report goes to stderr, like bash, once the pipeline is done; a
+ * `time` without a pipeline reports an empty run. A nested `time` keeps
+ * the stages of its own pipeline to itself.
+ *
+ * Returns: Exit status of the pipeline, or 2 on an invalid option
+ */
+int	execute_time(t_ast_node *ast, t_shell *shell)
+{
+	t_timing		timing;
+	t_timing		*outer;
+	struct timespec	start;
+	struct timespec	end;
+	struct rusage	before;
+
+	ft_memset(&timing, 0, sizeof(t_timing));
+	if (!time_flags(ast->args, &timing.flags))
+		return (record_status(shell, 2));
+	outer = shell->timing;
+	shell->timing = &timing;
+	getrusage(RUSAGE_SELF, &before);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	timing.status = record_status(shell, 0);
+	if (ast->left)
+		timing.status = execute_ast(ast->left, shell);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	self_usage(&before, &timing);
+	shell->timing = outer;
+	timing.real = elapsed(&start, &end);
+	time_report(&timing, ast->left);
+	free(timing.stages);
+	return (timing.status);
+}
@@ -0,0 +1,202 @@
+#include "includes/minishell.h"
+#include <stdio.h>
+
+/**
+ * tv_seconds - Converts a struct timeval to seconds
+ * @tv: Time value (tv_usec may be negative after a subtraction)
+ *
+ * Returns: Seconds
+ */
+static double	tv_seconds(struct timeval *tv)
+{
+	return (tv->tv_sec + tv->tv_usec / 1e6);
+}
+
+/**
+ * stage_text - Command line of one stage of the timed pipeline
+ * @pipeline: Left child of the NODE_TIME node, or NULL
+ * @i: Index of the stage
+ * @n: Number of stages recorded
+ *
+ * Walks down the left spine like pipeline_commands() does. The text is
+ * only rebuilt when the stages match the pipeline's commands one for
+ * one (a lone builtin records no stage at all).
+ *
+ * Returns: Allocated string, or NULL if the stage has no command
+ */
+static char	*stage_text(t_ast_node *pipeline, int i, int n)
+{
+	t_ast_node	*node;
+	int			count;
+
+	count = 1;
+	node = pipeline;
+	while (node && node->type == NODE_PIPE && ++count)
+		node = node->left;
+	if (!node || node->type != NODE_COMMAND || count != n)
+		return (NULL);
+	node = pipeline;
+	while (count-- > i + 1)
+		node = node->left;
+	if (node->type == NODE_PIPE)
+		node = node->right;
+	return (job_command_line(node));
+}
+
+/**
+ * print_json_string - Prints a string as a JSON string literal
+ * @str: String to print, or NULL for ""
+ */
+static void	print_json_string(char *str)
+{
+	int	i;
+
+	fputc('"', stderr);
+	i = 0;
+	while (str && str[i])
+	{
+		if (str[i] == '"' || str[i] == '\\')
+			fprintf(stderr, "\\%c", str[i]);
+		else if ((unsigned char)str[i] < 0x20)
+			fprintf(stderr, "\\u%04x", str[i]);
+		else
+			fputc(str[i], stderr);
+		i++;
+	}
+	fputc('"', stderr);
+}
+
+/**
+ * print_minutes - Prints a duration in the bash "0m0.000s" form
+ * @prefix: Text printed before the duration
+ * @seconds: Duration
+ */
+static void	print_minutes(char *prefix, double seconds)
+{
+	if (seconds < 0)
+		seconds = 0;
+	fprintf(stderr, "%s%dm%.3fs", prefix, (int)seconds / 60,
+		seconds - (int)seconds / 60 * 60);
+}
+
+/**
+ * print_stages - Prints one line (or JSON object) per stage
+ * @timing: Finished report
+ * @pipeline: Timed pipeline, for the command of each stage
+ *
+ * Human form: "[1]  real 0m0.101s  user 0m0.001s  sys 0m0.002s  maxrss
+ * 1180k  status 0  cat in". JSON form: the "stages" array members.
+ */
+static void	print_stages(t_timing *timing, t_ast_node *pipeline)
+{
+	t_stage_time	*st;
+	char			*cmd;
+	int				i;
+
+	i = -1;
+	while (++i < timing->count)
+	{
+		st = &timing->stages[i];
+		cmd = stage_text(pipeline, i, timing->count);
+		if (timing->flags & TIME_JSON)
+		{
+			if (i > 0)
+				fputc(',', stderr);
+			fprintf(stderr, "{\"cmd\":");
+			print_json_string(cmd);
+			fprintf(stderr, ",\"pid\":%d,\"status\":%d,\"real\":%.6f,"
+				"\"user\":%.6f,\"sys\":%.6f,\"maxrss_kb\":%ld}", st->pid,
+				st->status, st->real, tv_seconds(&st->ru.ru_utime),
+				tv_seconds(&st->ru.ru_stime), st->ru.ru_maxrss);
+		}
+		else
+		{
+			fprintf(stderr, "[%d]", i + 1);
+			print_minutes("  real ", st->real);
+			print_minutes("  user ", tv_seconds(&st->ru.ru_utime));
+			print_minutes("  sys ", tv_seconds(&st->ru.ru_stime));
+			fprintf(stderr, "  maxrss %ldk  status %d  %s\n",
+				st->ru.ru_maxrss, st->status, cmd ? cmd : "");
+		}
+		free(cmd);
+	}
+}
+
+/**
+ * print_line - Prints one total of the human-readable report
+ * @name: "real", "user" or "sys"
+ * @seconds: Value to print
+ * @posix: 1 for the `time -p` format
+ */
+static void	print_line(char *name, double seconds, int posix)
+{
+	if (posix)
+		fprintf(stderr, "%s %.2f\n", name, seconds * (seconds > 0));
+	else
+	{
+		fprintf(stderr, "%s\t", name);
+		print_minutes("", seconds);
+		fprintf(stderr, "\n");
+	}
+}
+
+/**
+ * time_report - Prints the report of a finished `time`
+ * @timing: Finished report
+ * @pipeline: Timed pipeline, for the command of each stage
+ *
+ * User and system time add up every stage plus the shell itself (for
+ * builtins); max RSS is the largest of any stage, or the shell's when
+ * nothing forked. The default form follows bash, -p follows POSIX and
+ * -j prints a single JSON object per run for scripts and CI:
+ *
+ * {"status":0,"real":0.105,"user":0.002,"sys":0.003,"maxrss_kb":1180,
+ *  "stages":[{"cmd":"sleep 0.1","pid":42,...}]}
+ *
+ * "stages" is only there with -s, which in the other forms prints one
+ * line per stage before the totals.
+ */
+void	time_report(t_timing *timing, t_ast_node *pipeline)
+{
+	double	user;
+	double	sys;
+	long	maxrss;
+	int		i;
+
+	user = tv_seconds(&timing->self.ru_utime);
+	sys = tv_seconds(&timing->self.ru_stime);
+	maxrss = 0;
+	i = -1;
+	while (++i < timing->count)
+	{
+		user += tv_seconds(&timing->stages[i].ru.ru_utime);
+		sys += tv_seconds(&timing->stages[i].ru.ru_stime);
+		if (timing->stages[i].ru.ru_maxrss > maxrss)
+			maxrss = timing->stages[i].ru.ru_maxrss;
+	}
+	if (timing->count == 0)
+		maxrss = timing->self.ru_maxrss;
+	if (timing->flags & TIME_JSON)
+	{
+		fprintf(stderr, "{\"status\":%d,\"real\":%.6f,\"user\":%.6f,"
+			"\"sys\":%.6f,\"maxrss_kb\":%ld", timing->status, timing->real,
+			user, sys, maxrss);
+		if (timing->flags & TIME_STAGES)
+		{
+			fprintf(stderr, ",\"stages\":[");
+			print_stages(timing, pipeline);
+			fprintf(stderr, "]");
+		}
+		fprintf(stderr, "}\n");
+		return ;
+	}
+	if (timing->flags & TIME_STAGES)
+		print_stages(timing, pipeline);
+	if (!(timing->flags & TIME_POSIX))
+		fprintf(stderr, "\n");
+	print_line("real", timing->real, timing->flags & TIME_POSIX);
+	print_line("user", user, timing->flags & TIME_POSIX);
+	print_line("sys", sys, timing->flags & TIME_POSIX);
+	if (!(timing->flags & TIME_POSIX))
+		fprintf(stderr, "maxrss\t%ldk\n", maxrss);
+}
@@ -0,0 +1,144 @@
+#include "includes/minishell.h"
+
+/**
+ * trace_now - Reads the monotonic clock
+ *
+ * Returns: Nanoseconds since an arbitrary origin
+ */
+long	trace_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000L + ts.tv_nsec);
+}
+
+/**
+ * trace_init - Turns tracing on when MINISHELL_TRACE is set
+ * @shell: Shell context
+ *
+ * The span ring is allocated once here, so recording a span never
+ * allocates. Without the variable shell->trace stays NULL and every
+ * TRACE_BEGIN/TRACE_END costs one never-taken branch. The lexer, parse,
+ * expand and execute stages read the clock at both ends regardless,
+ * for shellstats (see stats_stage()).
+ */
+void	trace_init(t_shell *shell)
+{
+	t_trace	*t;
+	char	*path;
+
+	path = getenv("MINISHELL_TRACE");
+	if (!path || !*path)
+		return ;
+	t = malloc(sizeof(t_trace));
+	if (!t)
+		return ;
+	t->spans = malloc(sizeof(t_span) * TRACE_SPANS);
+	t->path = ft_strdup(path);
+	if (!t->spans || !t->path)
+	{
+		free(t->spans);
+		free(t->path);
+		free(t);
+		return ;
+	}
+	t->count = 0;
+	t->pid = getpid();
+	t->origin = trace_now();
+	shell->trace = t;
+}
+
+/**
+ * trace_span - Records a span that started at start and ends now
+ * @t: Trace (not NULL)
+ * @name: Static name of the stage
+ * @start: trace_now() at the beginning of the stage
+ *
+ * Once the ring is full the oldest spans are overwritten.
+ */
+void	trace_span(t_trace *t, const char *name, long start)
+{
+	t_span	*s;
+
+	s = &t->spans[t->count % TRACE_SPANS];
+	s->name = name;
+	s->start = start;
+	s->dur = trace_now() - start;
+	t->count++;
+}
+
+/**
+ * trace_us - Writes nanoseconds as microseconds with three decimals
+ * @ob: Output buffer
+ * @ns: Duration or timestamp in nanoseconds
+ */
+static void	trace_us(t_outbuf *ob, long ns)
+{
+	char	buf[32];
+	int		i;
+
+	i = sizeof(buf);
+	buf[--i] = '0' + ns % 10;
+	buf[--i] = '0' + ns / 10 % 10;
+	buf[--i] = '0' + ns / 100 % 10;
+	buf[--i] = '.';
+	ns /= 1000;
+	buf[--i] = '0' + ns % 10;
+	while (ns >= 10)
+	{
+		ns /= 10;
+		buf[--i] = '0' + ns % 10;
+	}
+	outbuf_write(ob, buf + i, sizeof(buf) - i);
+}
+
+/**
+ * trace_dump - Writes the recorded spans as Chrome trace-event JSON
+ * @shell: Shell context
+ *
+ * Called when the shell exits, then releases the trace. Each span is a
+ * complete ("X") event with its timestamp relative to trace_init(); the
+ * file loads in chrome://tracing or Perfetto. Forked children never
+ * write it.
+ */
+void	trace_dump(t_shell *shell)
+{
+	t_trace		*t;
+	t_outbuf	ob;
+	long		i;
+
+	t = shell->trace;
+	if (!t || t->pid != getpid())
+		return ;
+	outbuf_init(&ob, open(t->path, O_WRONLY | O_CREAT | O_TRUNC, 0644));
+	if (ob.fd == -1)
+	{
+		perror("minishell: MINISHELL_TRACE");
+		return ;
+	}
+	outbuf_puts(&ob, "{\"traceEvents\":[\n");
+	i = 0;
+	if (t->count > TRACE_SPANS)
+		i = t->count - TRACE_SPANS;
+	while (i < t->count)
+	{
+		outbuf_puts(&ob, "{\"name\":\"");
+		outbuf_puts(&ob, t->spans[i % TRACE_SPANS].name);
+		outbuf_puts(&ob, "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":");
+		trace_us(&ob, t->spans[i % TRACE_SPANS].start - t->origin);
+		outbuf_puts(&ob, ",\"dur\":");
+		trace_us(&ob, t->spans[i % TRACE_SPANS].dur);
+		outbuf_puts(&ob, "}");
+		if (++i < t->count)
+			outbuf_putc(&ob, ',');
+		outbuf_putc(&ob, '\n');
+	}
+	outbuf_puts(&ob, "],\"displayTimeUnit\":\"ms\"}\n");
+	builtin_write_error("MINISHELL_TRACE", &ob);
+	close(ob.fd);
+	free(t->spans);
+	free(t->path);
+	free(t);
+	shell->trace = NULL;
+}
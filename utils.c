@@ -13,3 +13,44 @@ void	*control_malloc(size_t size, t_shell *shell)
 	}
 	return (buffer);
 }
+
+/**
+ * deadline_init - Turns a relative timeout into an absolute deadline
+ * @deadline: Deadline to fill (CLOCK_MONOTONIC)
+ * @timeout_ms: Timeout in milliseconds, or -1 for none
+ */
+void	deadline_init(struct timespec *deadline, int timeout_ms)
+{
+	if (timeout_ms < 0)
+		return ;
+	clock_gettime(CLOCK_MONOTONIC, deadline);
+	deadline->tv_sec += timeout_ms / 1000;
+	deadline->tv_nsec += (timeout_ms % 1000) * 1000000L;
+	if (deadline->tv_nsec >= 1000000000L)
+	{
+		deadline->tv_sec++;
+		deadline->tv_nsec -= 1000000000L;
+	}
+}
+
+/**
+ * deadline_left - Milliseconds left before a deadline
+ * @deadline: Deadline from deadline_init()
+ * @timeout_ms: The original timeout (-1 means no deadline)
+ *
+ * Returns: Remaining milliseconds (0 once passed), or -1 without deadline
+ */
+int	deadline_left(struct timespec *deadline, int timeout_ms)
+{
+	struct timespec	now;
+	long			left;
+
+	if (timeout_ms < 0)
+		return (-1);
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	left = (deadline->tv_sec - now.tv_sec) * 1000
+		+ (deadline->tv_nsec - now.tv_nsec) / 1000000;
+	if (left < 0)
+		return (0);
+	return (left);
+}